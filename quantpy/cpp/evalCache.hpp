@@ -0,0 +1,227 @@
+/**
+ * @file evalCache.hpp
+ * @brief Small open-addressing memoization cache for repeated function evaluations
+ * @details Dependent on the 'logging.hpp' header file
+ * @author Kasper Rantamäki
+ * @date 2026-08-29
+ */
+
+#ifndef EVAL_CACHE_HPP
+#define EVAL_CACHE_HPP
+
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include "logging.hpp"
+
+
+namespace quantpy {
+
+  namespace cpp {
+
+    namespace evalCache {
+
+
+      /**
+       * @brief Fixed size open-addressing cache keyed on quantized floating point arguments
+       * @details Memoizes an expensive T(T...) evaluation, e.g. a pricing kernel queried at the
+       * overlapping points of finite difference stencils. The arguments are quantized onto a grid
+       * of the given quantum before hashing, so evaluations at floating point arguments equal up
+       * to the quantum share one entry. The table is a flat array probed linearly with a bounded
+       * probe length: on a full neighbourhood the oldest probed slot is simply overwritten, so
+       * the cache never allocates after construction and lookups stay a handful of comparisons
+       * over contiguous memory
+       * @tparam T      The type of the cached values and the arguments. Should be some floating point number type
+       * @tparam nKeys  The number of arguments forming the key
+       */
+      template <typename T, int nKeys>
+      class EvalCache {
+
+        protected:
+
+          static constexpr int N_SLOTS = 256;      /**< The number of slots in the table. Should be a power of two */
+          static constexpr int MAX_PROBES = 8;     /**< The maximum linear probe length before an entry is evicted */
+
+          std::vector<std::int64_t> _keys;  /**< The quantized keys of the slots, 'nKeys' per slot */
+          std::vector<T> _vals;             /**< The cached values of the slots */
+          std::vector<bool> _used;          /**< Boolean flags telling which slots hold an entry */
+          T _quantum;                       /**< The quantization grid spacing for the arguments */
+
+
+          /**
+           * @brief Quantizes the floating point arguments onto the key grid
+           * @param args   The arguments forming the key
+           * @param qkeys  Pointer to a buffer of 'nKeys' values into which the quantized key is written
+           * @returns      Void. The key is written into the 'qkeys' buffer
+           */
+          void _quantize(const T* args, std::int64_t* qkeys) const {
+
+            for (int i = 0; i < nKeys; i++) {
+              qkeys[i] = (std::int64_t)llround(args[i] / this->_quantum);
+            }
+
+          }
+
+
+          /**
+           * @brief Hashes a quantized key onto a slot index
+           * @details A Fibonacci style multiplicative mix folded over the key components. The table
+           * size is a power of two, so the slot follows from a mask instead of a modulo
+           * @param qkeys  The quantized key
+           * @returns      The slot index the probing starts from
+           */
+          int _hash(const std::int64_t* qkeys) const {
+
+            std::uint64_t h = (std::uint64_t)0x9e3779b97f4a7c15ull;
+
+            for (int i = 0; i < nKeys; i++) {
+              h ^= (std::uint64_t)qkeys[i] + (std::uint64_t)0x9e3779b97f4a7c15ull + (h << 6) + (h >> 2);
+            }
+
+            return (int)(h & (std::uint64_t)(N_SLOTS - 1));
+
+          }
+
+
+          /**
+           * @brief Tells whether a slot holds the given quantized key
+           * @param slot   The slot index
+           * @param qkeys  The quantized key
+           * @returns      Boolean telling whether the slot holds the key
+           */
+          bool _matches(int slot, const std::int64_t* qkeys) const {
+
+            for (int i = 0; i < nKeys; i++) {
+              if ( this->_keys[slot * nKeys + i] != qkeys[i] ) {
+                return false;
+              }
+            }
+
+            return true;
+
+          }
+
+        public:
+
+          /**
+           * @brief Main constructor
+           * @param quantum  The quantization grid spacing for the arguments. Defaults to 1e-9,
+           * which is well below the finite difference steps the cache typically backs
+           * @returns        Initialized EvalCache object
+           */
+          EvalCache(T quantum = (T)1e-9) : _quantum(quantum) {
+
+            if ( quantum <= (T)0. ) {
+              ERROR("The quantum must be positive! (", quantum, " <= 0)");
+            }
+
+            this->_keys.assign(N_SLOTS * nKeys, 0);
+            this->_vals.assign(N_SLOTS, (T)0.);
+            this->_used.assign(N_SLOTS, false);
+
+          }
+
+
+          /**
+           * @brief Getter for the quantization grid spacing
+           * @returns The quantization grid spacing
+           */
+          const T& quantum() const { return this->_quantum; }
+
+
+          /**
+           * @brief Empties the cache
+           * @details Used by the owners of the cache to invalidate the entries when the parameters
+           * behind the cached evaluations change
+           * @returns Void
+           */
+          void clear() {
+
+            this->_used.assign(N_SLOTS, false);
+
+          }
+
+
+          /**
+           * @brief Looks up the cached value for the given arguments
+           * @param args   The arguments forming the key
+           * @param value  Reference into which the cached value is written on a hit
+           * @returns      Boolean telling whether the arguments were found in the cache
+           */
+          bool lookup(const T* args, T& value) const {
+
+            std::int64_t qkeys[nKeys];
+            this->_quantize(args, qkeys);
+
+            int slot = this->_hash(qkeys);
+
+            for (int probe = 0; probe < MAX_PROBES; probe++) {
+
+              int i = (slot + probe) & (N_SLOTS - 1);
+
+              if ( !this->_used[i] ) {
+                return false;
+              }
+
+              if ( this->_matches(i, qkeys) ) {
+                value = this->_vals[i];
+                return true;
+              }
+
+            }
+
+            return false;
+
+          }
+
+
+          /**
+           * @brief Inserts a value for the given arguments
+           * @details Probes linearly for an empty slot or an existing entry with the same key. If
+           * the whole probe neighbourhood is occupied by other keys the first probed slot is
+           * overwritten, which keeps the insert constant time at the cost of evicting one entry
+           * @param args   The arguments forming the key
+           * @param value  The value to be cached
+           * @returns      Void
+           */
+          void insert(const T* args, T value) {
+
+            std::int64_t qkeys[nKeys];
+            this->_quantize(args, qkeys);
+
+            int slot = this->_hash(qkeys);
+            int target = slot;
+
+            for (int probe = 0; probe < MAX_PROBES; probe++) {
+
+              int i = (slot + probe) & (N_SLOTS - 1);
+
+              if ( !this->_used[i] || this->_matches(i, qkeys) ) {
+                target = i;
+                break;
+              }
+
+            }
+
+            for (int i = 0; i < nKeys; i++) {
+              this->_keys[target * nKeys + i] = qkeys[i];
+            }
+
+            this->_vals[target] = value;
+            this->_used[target] = true;
+
+          }
+
+      };
+
+
+    }
+
+  }
+
+}
+
+
+#endif
@@ -0,0 +1,275 @@
+/**
+ * @file flatMap.hpp
+ * @brief Cache-friendly sorted-vector map
+ * @details Dependent on the 'logging.hpp' header file
+ * @author Kasper Rantamäki
+ * @date 2026-08-29
+ */
+
+#ifndef FLAT_MAP_HPP
+#define FLAT_MAP_HPP
+
+
+#include <algorithm>
+#include <map>
+#include <vector>
+
+#include "logging.hpp"
+
+
+namespace quantpy {
+
+  namespace cpp {
+
+    namespace flatMap {
+
+
+      /**
+       * @brief Map backed by sorted contiguous key and value arrays
+       * @details Unlike std::map the keys and values live in two flat vectors, so lookups are a
+       * binary search over contiguous memory instead of a pointer chase through a red-black tree,
+       * and iteration is a linear scan. Insertion shifts the tails of the arrays and is therefore
+       * linear, which is the right trade for the small, build-once-query-often tables this backs —
+       * e.g. a (tenor, rate) term structure queried on every simulation step. Supports linear
+       * interpolation between the stored keys for exactly that use
+       * @tparam keyType  The type for the keys in the map. Should be ordered
+       * @tparam valType  The type for the values in the map
+       */
+      template <typename keyType, typename valType>
+      class FlatMap {
+
+        protected:
+
+          std::vector<keyType> _keys;  /**< The sorted keys of the map */
+          std::vector<valType> _vals;  /**< The values of the map in key order */
+
+
+          /**
+           * @brief Finds the index of the first key not less than the given key
+           * @param key  The key searched for
+           * @returns    The index of the first key not less than the given key
+           */
+          int _lowerBound(const keyType& key) const {
+
+            return (int)(std::lower_bound(this->_keys.begin(), this->_keys.end(), key) - this->_keys.begin());
+
+          }
+
+        public:
+
+          /**
+           * @brief Default constructor. Initializes an empty map
+           * @returns Initialized FlatMap object
+           */
+          FlatMap() { }
+
+
+          /**
+           * @brief Main constructor. Builds the map from key and value vectors
+           * @details The pairs are sorted by key, so the given vectors don't need to be ordered
+           * @param keys  The keys of the map. Should contain no duplicates
+           * @param vals  The values of the map in the same order as the keys
+           * @returns     Initialized FlatMap object
+           */
+          FlatMap(const std::vector<keyType>& keys, const std::vector<valType>& vals) {
+
+            if ( keys.size() != vals.size() ) {
+              ERROR("The number of keys and values must match! (", keys.size(), " != ", vals.size(), ")");
+            }
+
+            // Sort an index permutation by key and apply it to both arrays
+            std::vector<int> order(keys.size());
+
+            for (int i = 0; i < (int)keys.size(); i++) {
+              order[i] = i;
+            }
+
+            std::sort(order.begin(), order.end(), [&](int i, int j) { return keys[i] < keys[j]; });
+
+            this->_keys.reserve(keys.size());
+            this->_vals.reserve(vals.size());
+
+            for (int i = 0; i < (int)order.size(); i++) {
+
+              if ( i > 0 && !(this->_keys.back() < keys[order[i]]) ) {
+                ERROR("The keys must be unique!");
+              }
+
+              this->_keys.push_back(keys[order[i]]);
+              this->_vals.push_back(vals[order[i]]);
+
+            }
+
+          }
+
+
+          /**
+           * @brief Converting constructor from a std::map
+           * @param map  The map from which the pairs are copied
+           * @returns    Initialized FlatMap object
+           */
+          FlatMap(const std::map<keyType, valType>& map) {
+
+            this->_keys.reserve(map.size());
+            this->_vals.reserve(map.size());
+
+            // A std::map iterates in key order, so the arrays come out sorted
+            for (const auto& [key, val] : map) {
+              this->_keys.push_back(key);
+              this->_vals.push_back(val);
+            }
+
+          }
+
+
+          /**
+           * @brief Getter for the number of pairs in the map
+           * @returns The number of pairs in the map
+           */
+          int size() const { return (int)this->_keys.size(); }
+
+
+          /**
+           * @brief Allocation-free view over the sorted keys of the map
+           * @returns Constant reference to the key vector
+           */
+          const std::vector<keyType>& keys() const { return this->_keys; }
+
+
+          /**
+           * @brief Allocation-free view over the values of the map in key order
+           * @returns Constant reference to the value vector
+           */
+          const std::vector<valType>& vals() const { return this->_vals; }
+
+
+          /**
+           * @brief Tells whether the map holds the given key
+           * @param key  The key searched for
+           * @returns    Boolean telling whether the key is in the map
+           */
+          bool contains(const keyType& key) const {
+
+            int i = this->_lowerBound(key);
+
+            return i < this->size() && !(key < this->_keys[i]);
+
+          }
+
+
+          /**
+           * @brief Accessor for the value stored at the given key
+           * @param key  The key searched for
+           * @returns    Constant reference to the value stored at the key
+           */
+          const valType& at(const keyType& key) const {
+
+            int i = this->_lowerBound(key);
+
+            if ( i >= this->size() || key < this->_keys[i] ) {
+              ERROR("The given key is not in the map!");
+            }
+
+            return this->_vals[i];
+
+          }
+
+
+          /**
+           * @brief Inserts a pair into the map or overwrites the value of an existing key
+           * @details Shifts the tails of the arrays, so building a large map is cheapest through
+           * the vector constructor
+           * @param key  The key under which the value is stored
+           * @param val  The value to be stored
+           * @returns    Void
+           */
+          void insert(const keyType& key, const valType& val) {
+
+            int i = this->_lowerBound(key);
+
+            if ( i < this->size() && !(key < this->_keys[i]) ) {
+              this->_vals[i] = val;
+              return;
+            }
+
+            this->_keys.insert(this->_keys.begin() + i, key);
+            this->_vals.insert(this->_vals.begin() + i, val);
+
+          }
+
+
+          /**
+           * @brief Linearly interpolated value at the given key
+           * @details Exact keys return the stored value, keys between two stored keys the linear
+           * interpolation of their values. Keys outside the stored range raise an error, as
+           * extrapolating e.g. a term structure silently is rarely what the caller wants
+           * @param key  The key for which the value is evaluated
+           * @returns    The (interpolated) value at the key
+           */
+          valType interpolate(const keyType& key) const {
+
+            if ( this->size() == 0 ) {
+              ERROR("Can not interpolate on an empty map!");
+            }
+
+            if ( key < this->_keys.front() || this->_keys.back() < key ) {
+              ERROR("The given key is outside of the stored key range!");
+            }
+
+            int i = this->_lowerBound(key);
+
+            if ( !(key < this->_keys[i]) ) {
+              return this->_vals[i];
+            }
+
+            valType weight = (valType)(key - this->_keys[i - 1]) / (valType)(this->_keys[i] - this->_keys[i - 1]);
+
+            return this->_vals[i - 1] + weight * (this->_vals[i] - this->_vals[i - 1]);
+
+          }
+
+      };
+
+
+      /**
+       * @brief Template function that retrieves all keys in a FlatMap
+       * @details Unlike the std::map counterpart in utils the keys are already contiguous, so the
+       * view is returned without copying or allocating
+       * @tparam keyType  The type for the keys in the map
+       * @tparam valType  The type for the values in the map
+       * @param map       The map from which the keys are to be retrieved
+       * @returns         Constant reference to the sorted key vector
+       */
+      template <typename keyType, typename valType>
+      const std::vector<keyType>& mapKeys(const FlatMap<keyType, valType>& map) {
+
+        return map.keys();
+
+      }
+
+
+      /**
+       * @brief Template function that retrieves all values in a FlatMap
+       * @details Unlike the std::map counterpart in utils the values are already contiguous, so the
+       * view is returned without copying or allocating
+       * @tparam keyType  The type for the keys in the map
+       * @tparam valType  The type for the values in the map
+       * @param map       The map from which the values are to be retrieved
+       * @returns         Constant reference to the value vector in key order
+       */
+      template <typename keyType, typename valType>
+      const std::vector<valType>& mapVals(const FlatMap<keyType, valType>& map) {
+
+        return map.vals();
+
+      }
+
+
+    }
+
+  }
+
+}
+
+
+#endif
@@ -10,10 +10,17 @@
 #define FILE_UTILS_HPP
 
 
+#include <cstring>
 #include <iostream>
 #include <string>
+#include <string_view>
 #include <sstream>
 
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
 #include "logging.hpp"
 #include "sutils.hpp"
 
@@ -26,51 +33,248 @@ namespace quantpy {
 
 
       /**
-       * @brief Function for reading the last line of a given text file
-       * @details For more discussion on this approach see 
-       * https://stackoverflow.com/questions/11876290/c-fastest-way-to-read-only-last-line-of-text-file
-       * @param filepath  Constant string pointer with the path to the wanted file
-       * @returns         The last line as a std::stringstream object
+       * @brief Memory-mapped read-only view of a file
+       * @details Maps the whole file into the address space with mmap, so the contents can be
+       * scanned as raw bytes without the per-character overhead of the ifstream layer and without
+       * copying the data into intermediate buffers. The lines are exposed as std::string_view
+       * objects pointing straight into the mapping, which stays valid for the lifetime of the
+       * MappedFile object. Intended for feeding the pricers from large end-of-day quote and curve
+       * files, where stream-based parsing dominates the cold start
        */
-      inline std::stringstream lastLine(const std::string& filepath) {
+      class MappedFile {
 
-        std::ifstream _file(filepath);
+        protected:
 
-        if ( !_file ) {
-          ERROR("Couldn't open the given file!");
-        }
+          const char* _data;   /**< Pointer to the start of the mapping */
+          std::size_t _size;   /**< The size of the file in bytes */
+          int _fd;             /**< The underlying file descriptor */
 
-        char c;
-        _file.seekg(-1, std::ios_base::end);  // Go to last non EOF char
+        public:
 
-        _file.get(c);
+          /**
+           * @brief Main constructor. Opens and maps the given file
+           * @param filepath  Constant string pointer with the path to the wanted file
+           * @returns         Initialized MappedFile object
+           */
+          explicit MappedFile(const std::string& filepath) : _data(nullptr), _size(0) {
 
-        if ( c == '\n' ) {  // File ends with a newline char. Ignore it
-          _file.seekg(-2, std::ios_base::cur);
-          _file.get(c);
-        }
+            this->_fd = open(filepath.c_str(), O_RDONLY);
+
+            if ( this->_fd < 0 ) {
+              ERROR("Couldn't open the given file!");
+            }
+
+            struct stat fileStat;
+
+            if ( fstat(this->_fd, &fileStat) < 0 ) {
+              close(this->_fd);
+              ERROR("Couldn't stat the given file!");
+            }
 
-        bool cont = true;
-        while ( cont ) {
+            this->_size = (std::size_t)fileStat.st_size;
+
+            // An empty file has nothing to map
+            if ( this->_size == 0 ) {
+              return;
+            }
+
+            void* mapping = mmap(nullptr, this->_size, PROT_READ, MAP_PRIVATE, this->_fd, 0);
+
+            if ( mapping == MAP_FAILED ) {
+              close(this->_fd);
+              ERROR("Couldn't map the given file into memory!");
+            }
+
+            this->_data = (const char*)mapping;
+
+            // The typical access pattern is a single forward scan over the records
+            madvise(mapping, this->_size, MADV_SEQUENTIAL);
 
-          if ( c == '\n' ) {  // End of the last line found
-            _file.seekg(1, std::ios_base::cur);
-            cont = false; 
           }
 
-          // Continue
-          _file.seekg(-2, std::ios_base::cur);
-          _file.get(c);
-        }
 
-        std::string lastLine;
-        std::getline(_file, lastLine);
+          /**
+           * @brief Destructor. Unmaps the file and closes the descriptor
+           */
+          ~MappedFile() {
+
+            if ( this->_data != nullptr ) {
+              munmap((void*)this->_data, this->_size);
+            }
+
+            if ( this->_fd >= 0 ) {
+              close(this->_fd);
+            }
+
+          }
+
+
+          // The object owns the mapping, so copying is disallowed
+          MappedFile(const MappedFile&) = delete;
+          MappedFile& operator=(const MappedFile&) = delete;
+
+
+          /**
+           * @brief Getter for the pointer to the start of the mapping
+           * @returns Pointer to the raw bytes of the file
+           */
+          const char* data() const { return this->_data; }
+
+
+          /**
+           * @brief Getter for the size of the file
+           * @returns The size of the file in bytes
+           */
+          std::size_t size() const { return this->_size; }
+
+
+          /**
+           * @brief The whole file as a single zero-copy view
+           * @returns A std::string_view over the raw bytes of the file
+           */
+          std::string_view view() const { return std::string_view(this->_data, this->_size); }
+
+
+          /**
+           * @brief Forward iterator over the lines of the mapping
+           * @details Dereferencing yields a std::string_view over a single line without its
+           * terminating newline character. A trailing newline at the end of the file does not
+           * produce an extra empty line
+           */
+          class LineIterator {
+
+            protected:
+
+              const char* _lineStart;  /**< Pointer to the start of the current line */
+              const char* _lineEnd;    /**< Pointer one past the end of the current line */
+              const char* _end;        /**< Pointer one past the end of the mapping */
+
+
+              /**
+               * @brief Finds the end of the current line. To be called after advancing the start
+               * @returns Void. The line end pointer is updated in place
+               */
+              void _findLineEnd() {
+
+                if ( this->_lineStart == this->_end ) {
+                  this->_lineEnd = this->_end;
+                  return;
+                }
+
+                const char* newline = (const char*)memchr(this->_lineStart, '\n', (std::size_t)(this->_end - this->_lineStart));
+                this->_lineEnd = newline == nullptr ? this->_end : newline;
+
+              }
+
+            public:
+
+              /**
+               * @brief Main constructor. To be called through 'begin' and 'end'
+               * @param start  Pointer to the start of the iteration
+               * @param end    Pointer one past the end of the mapping
+               * @returns      Initialized LineIterator object
+               */
+              LineIterator(const char* start, const char* end) : _lineStart(start), _end(end) {
 
-        std::stringstream ret(lastLine);
+                this->_findLineEnd();
 
-        _file.close();
+              }
 
-        return ret;
+
+              /**
+               * @brief Dereference operator
+               * @returns A std::string_view over the current line without the newline character
+               */
+              std::string_view operator* () const {
+
+                return std::string_view(this->_lineStart, (std::size_t)(this->_lineEnd - this->_lineStart));
+
+              }
+
+
+              /**
+               * @brief Advances the iterator to the next line
+               * @returns Reference to the advanced iterator
+               */
+              LineIterator& operator++ () {
+
+                this->_lineStart = this->_lineEnd == this->_end ? this->_end : this->_lineEnd + 1;
+                this->_findLineEnd();
+
+                return *this;
+
+              }
+
+
+              /**
+               * @brief Inequality comparison. Used as the loop condition in range-based iteration
+               * @param other  The iterator compared against
+               * @returns      Boolean telling whether the iterators point to different lines
+               */
+              bool operator!= (const LineIterator& other) const {
+
+                return this->_lineStart != other._lineStart;
+
+              }
+
+          };
+
+
+          /**
+           * @brief Iterator to the first line of the file
+           * @returns A LineIterator at the start of the mapping
+           */
+          LineIterator begin() const { return LineIterator(this->_data, this->_data + this->_size); }
+
+
+          /**
+           * @brief Iterator past the last line of the file
+           * @returns A LineIterator at the end of the mapping
+           */
+          LineIterator end() const { return LineIterator(this->_data + this->_size, this->_data + this->_size); }
+
+
+          /**
+           * @brief The last line of the file as a zero-copy view
+           * @details A trailing newline at the end of the file is ignored, matching the behaviour of
+           * the 'lastLine' free function
+           * @returns A std::string_view over the last line of the file
+           */
+          std::string_view lastLine() const {
+
+            const char* end = this->_data + this->_size;
+
+            // Ignore a trailing newline char
+            if ( this->_size > 0 && *(end - 1) == '\n' ) {
+              end--;
+            }
+
+            const char* start = end;
+
+            while ( start > this->_data && *(start - 1) != '\n' ) {
+              start--;
+            }
+
+            return std::string_view(start, (std::size_t)(end - start));
+
+          }
+
+      };
+
+
+      /**
+       * @brief Function for reading the last line of a given text file
+       * @details Implemented on top of the memory-mapped reader, which locates the line in the raw
+       * bytes instead of walking the file backwards one seekg/get character at a time through the
+       * ifstream layer
+       * @param filepath  Constant string pointer with the path to the wanted file
+       * @returns         The last line as a std::stringstream object
+       */
+      inline std::stringstream lastLine(const std::string& filepath) {
+
+        MappedFile file(filepath);
+
+        return std::stringstream(std::string(file.lastLine()));
 
       }
 
@@ -96,9 +300,17 @@ namespace quantpy {
             return logfilePath;
           }
 
-          // Check if the directory in which the log is to be stored exists. If not create it
-          std::vector<std::string> path_vector = sutils::split(_logfilePath, '/');
-          std::string dir_path = sutils::join(std::vector<std::string>(path_vector.begin(), path_vector.end() - 1), '/');
+          // Check if the directory in which the log is to be stored exists. If not create it.
+          // The directory part is everything before the last path token, found with the zero-copy
+          // tokenizer instead of materializing the path components
+          std::string_view path_view = std::string_view(_logfilePath);
+          std::string_view last_token = path_view;
+
+          sutils::forEachToken(path_view, '/', [&](std::string_view token) {
+            last_token = token;
+          });
+
+          std::string_view dir_path = path_view.substr(0, (std::size_t)(last_token.data() - path_view.data()));
           DEBUG(dir_path);
           
           //if ( !std::filesystem::exists(dir_path) ) {
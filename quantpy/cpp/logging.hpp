@@ -16,15 +16,31 @@
 #include <sstream>
 #include <filesystem>
 #include <cstdarg>
+#include <atomic>
+#include <thread>
+#include <chrono>
+#include <memory>
 
 #include "utils.hpp"
 
 
 /**
  * @brief The base verbosity level
- * @todo Instead of hardcoding this it should be alterable at least at compile time
  */
-#define BASE_VERBOSITY 3
+#ifndef BASE_VERBOSITY
+  #define BASE_VERBOSITY 3
+#endif
+
+
+/**
+ * @brief The compile-time verbosity ceiling
+ * @details Macros for levels above the ceiling expand to nothing, so disabled messages cost
+ * literally zero instructions on the hot paths. Can be lowered on the compiler command line,
+ * e.g. -DMAX_VERBOSITY=3 elides the LOWPRIORITY and DEBUG macros entirely
+ */
+#ifndef MAX_VERBOSITY
+  #define MAX_VERBOSITY 5
+#endif
 
 
 // Define macros for easier usage of the logging functions
@@ -46,7 +62,11 @@
  * @param ...  Variadic arguments from which the warning message is formed
  * @returns    Void
  */
-#define WARNING(...) { quantpy::cpp::logging::_warningMsg(__func__, __VA_ARGS__); }
+#if MAX_VERBOSITY > 1
+  #define WARNING(...) { quantpy::cpp::logging::_warningMsg(__func__, __VA_ARGS__); }
+#else
+  #define WARNING(...) {  }
+#endif
 
 
 /**
@@ -55,7 +75,11 @@
  * @param ...  Variadic arguments from which the info message is formed
  * @returns    Void
  */
-#define INFO(...) { quantpy::cpp::logging::_infoMsg(__func__, __VA_ARGS__); }
+#if MAX_VERBOSITY > 2
+  #define INFO(...) { quantpy::cpp::logging::_infoMsg(__func__, __VA_ARGS__); }
+#else
+  #define INFO(...) {  }
+#endif
 
 
 /**
@@ -64,7 +88,11 @@
  * @param ...  Variadic arguments from which the low priority info message is formed
  * @returns    Void
  */
-#define LOWPRIORITY(...) { quantpy::cpp::logging::_lowPriorityMsg(__func__, __VA_ARGS__); }
+#if MAX_VERBOSITY > 3
+  #define LOWPRIORITY(...) { quantpy::cpp::logging::_lowPriorityMsg(__func__, __VA_ARGS__); }
+#else
+  #define LOWPRIORITY(...) {  }
+#endif
 
 
 /**
@@ -73,7 +101,11 @@
  * @param ...  Variadic arguments from which the debug message is formed
  * @returns    Void
  */
-#define DEBUG(...) { quantpy::cpp::logging::_debugMsg(__func__, __VA_ARGS__); }
+#if MAX_VERBOSITY > 4
+  #define DEBUG(...) { quantpy::cpp::logging::_debugMsg(__func__, __VA_ARGS__); }
+#else
+  #define DEBUG(...) {  }
+#endif
 
 
 namespace quantpy {
@@ -116,6 +148,235 @@ namespace quantpy {
       }
 
 
+      /**
+       * @brief Bounded lock-free ring buffer drained by a dedicated writer thread
+       * @details Implements the bounded multi-producer queue of Vyukov [1] with per-slot sequence
+       * numbers, so concurrent e.g. OpenMP pricing threads can append messages without taking a lock
+       * or serializing on the stream flush. A full buffer drops the message and counts the drop
+       * rather than blocking a hot thread. The writer thread drains the buffer to stdout and the
+       * remaining messages are flushed when the buffer is destroyed at program exit
+       * [1]: D. Vyukov. "Bounded MPMC queue", 1024cores.net, 2011
+       */
+      class AsyncLogBuffer {
+
+        protected:
+
+          static constexpr int RING_SIZE = 1024;  /**< The number of message slots. Needs to be a power of two */
+
+
+          /**
+           * @struct slotStruct
+           * @brief Struct for holding a single message slot
+           * @var slotStruct::sequence  The sequence number synchronizing the producers and the consumer
+           * @var slotStruct::message   The message itself
+           */
+          typedef struct {
+            std::atomic<size_t> sequence;
+            std::string message;
+          } slotStruct;
+
+
+          std::unique_ptr<slotStruct[]> slots;  /**< The message slots */
+          std::atomic<size_t> enqueuePos{0};    /**< The position of the next message to be written */
+          std::atomic<size_t> dequeuePos{0};    /**< The position of the next message to be read */
+          std::atomic<size_t> droppedCount{0};  /**< The number of messages dropped due to a full buffer */
+          std::atomic<bool> running{false};     /**< Flag telling if the writer thread is active */
+          std::thread writer;                   /**< The writer thread draining the buffer */
+
+
+          /**
+           * @brief Pops the next message from the buffer if one is available
+           * @details Only called from the single consumer, i.e. the writer thread and the destructor
+           * @param message  The string into which the message is moved
+           * @returns        True if a message was popped, false if the buffer was empty
+           */
+          bool pop(std::string& message) {
+
+            size_t pos = dequeuePos.load(std::memory_order_relaxed);
+            slotStruct& slot = slots[pos % RING_SIZE];
+            size_t seq = slot.sequence.load(std::memory_order_acquire);
+
+            if ( (intptr_t)seq - (intptr_t)(pos + 1) < 0 ) {
+              return false;
+            }
+
+            message = std::move(slot.message);
+            slot.sequence.store(pos + RING_SIZE, std::memory_order_release);
+            dequeuePos.store(pos + 1, std::memory_order_relaxed);
+
+            return true;
+
+          }
+
+        public:
+
+          /**
+           * @brief Default constructor. Does not start the writer thread
+           * @returns  Initialized AsyncLogBuffer object
+           */
+          AsyncLogBuffer() {
+
+            slots = std::unique_ptr<slotStruct[]>(new slotStruct[RING_SIZE]);
+
+            for (int i = 0; i < RING_SIZE; i++) {
+              slots[i].sequence.store((size_t)i, std::memory_order_relaxed);
+            }
+
+          }
+
+
+          /**
+           * @brief Destructor. Stops the writer thread and flushes the remaining messages
+           */
+          ~AsyncLogBuffer() {
+
+            if ( running.load(std::memory_order_relaxed) ) {
+              running.store(false, std::memory_order_relaxed);
+              writer.join();
+            }
+
+            std::string message;
+            while ( pop(message) ) {
+              std::cout << message << "\n";
+            }
+
+            size_t dropped = droppedCount.load(std::memory_order_relaxed);
+            if ( dropped > 0 ) {
+              std::cout << "AsyncLogBuffer: " << dropped << " messages dropped due to a full buffer" << "\n";
+            }
+
+            std::cout << std::flush;
+
+          }
+
+
+          /**
+           * @brief Starts the writer thread draining the buffer
+           * @returns Void
+           */
+          void start() {
+
+            if ( running.load(std::memory_order_relaxed) ) {
+              return;
+            }
+
+            running.store(true, std::memory_order_relaxed);
+
+            writer = std::thread([this]() {
+
+              std::string message;
+
+              while ( running.load(std::memory_order_relaxed) ) {
+                if ( pop(message) ) {
+                  std::cout << message << "\n";
+                }
+                else {
+                  std::cout << std::flush;
+                  std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                }
+              }
+
+            });
+
+          }
+
+
+          /**
+           * @brief Appends a message to the buffer without blocking
+           * @details Safe to call concurrently from any number of producer threads
+           * @param message  The message to append
+           * @returns        True if the message was appended, false if the buffer was full and the message dropped
+           */
+          bool push(std::string&& message) {
+
+            size_t pos = enqueuePos.load(std::memory_order_relaxed);
+
+            for (;;) {
+
+              slotStruct& slot = slots[pos % RING_SIZE];
+              size_t seq = slot.sequence.load(std::memory_order_acquire);
+              intptr_t diff = (intptr_t)seq - (intptr_t)pos;
+
+              if ( diff == 0 ) {
+                if ( enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed) ) {
+                  slot.message = std::move(message);
+                  slot.sequence.store(pos + 1, std::memory_order_release);
+                  return true;
+                }
+              }
+              else if ( diff < 0 ) {
+                droppedCount.fetch_add(1, std::memory_order_relaxed);
+                return false;
+              }
+              else {
+                pos = enqueuePos.load(std::memory_order_relaxed);
+              }
+
+            }
+
+          }
+
+      };
+
+
+      /**
+       * @brief Accessor for the shared log buffer instance
+       * @returns A reference to the shared AsyncLogBuffer object
+       */
+      inline AsyncLogBuffer& _logBuffer() {
+
+        static AsyncLogBuffer buffer;
+
+        return buffer;
+
+      }
+
+
+      /**
+       * @brief Function that defines and returns whether the asynchronous logging backend is active
+       * @details When activated the logging macros append their messages to a lock-free ring buffer
+       * drained by a dedicated writer thread instead of writing to stdout synchronously, so hot
+       * threads are never serialized on a stream flush. Note that like the verbosity the backend
+       * can only be activated once during the program execution
+       * @param _async  Boolean flag activating the asynchronous backend. Defaults to 'false'
+       * @returns       True if the asynchronous backend is active
+       */
+      inline bool asyncLogging(bool _async = false) {
+
+        static bool firstCall = true;
+        static bool active = false;
+
+        if ( firstCall ) {
+          firstCall = false;
+
+          if ( _async ) {
+            _logBuffer().start();
+            active = true;
+          }
+        }
+
+        return active;
+
+      }
+
+
+      /**
+       * @brief Function that emits a fully formed message through the active backend
+       * @param message  The message to emit
+       * @returns        Void
+       */
+      inline void _emit(std::string&& message) {
+
+        if ( asyncLogging() ) {
+          _logBuffer().push(std::move(message));
+        }
+        else {
+          std::cout << message << std::endl;
+        }
+
+      }
+
+
       /**
        * @brief Function that generates and throws a more descriptive (runtime) error
        * @details The error message consists of the filename, function name, linenumber and the message itself
@@ -154,7 +415,7 @@ namespace quantpy {
       void _warningMsg(const char* func, Args... args) {
 
         if (verbosity() > 1) {
-          std::cout << func << ": " << "WARNING! " << utils::formString(args...) << std::endl;
+          _emit(utils::formString(func, ": ", "WARNING! ", utils::formString(args...)));
         }
         
       }
@@ -173,7 +434,7 @@ namespace quantpy {
       void _infoMsg(const char* func, Args... args) {
 
         if (verbosity() > 2) {
-          std::cout << func << ": " << utils::formString(args...) << std::endl;
+          _emit(utils::formString(func, ": ", utils::formString(args...)));
         }
 
       }
@@ -192,7 +453,7 @@ namespace quantpy {
       void _lowPriorityMsg(const char* func, Args... args) {
 
         if (verbosity() > 3) {
-          std::cout << func << ": " << utils::formString(args...) << std::endl;
+          _emit(utils::formString(func, ": ", utils::formString(args...)));
         }
 
       }
@@ -211,7 +472,7 @@ namespace quantpy {
       void _debugMsg(const char* func, Args... args) {
 
         if (verbosity() > 4) {
-          std::cout << func << ": " << "DEBUG - " << utils::formString(args...) << std::endl;
+          _emit(utils::formString(func, ": ", "DEBUG - ", utils::formString(args...)));
         }
 
       }
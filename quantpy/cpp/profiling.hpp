@@ -0,0 +1,324 @@
+/**
+ * @file profiling.hpp
+ * @brief Scoped hot-path profiling instrumentation with histogram aggregation
+ * @details Provides RAII timer macros in the style of the logging macros. A PROFILE_SCOPE reads the
+ * cycle counter on entry and exit and records the elapsed cycles into a per-label histogram held in
+ * thread-local storage, so instrumented hot paths never contend on a shared structure. The
+ * histograms are merged and reported at the end of the run with PROFILE_REPORT.
+ *
+ * The instrumentation is only active when ENABLE_PROFILING is defined (e.g. -DENABLE_PROFILING on
+ * the compiler command line). Without it every macro expands to nothing, so instrumented code costs
+ * zero instructions in normal builds.
+ * Dependent on the 'logging.hpp' header file
+ * @author Kasper Rantamäki
+ * @date 2026-08-29
+ */
+
+#ifndef PROFILING_HPP
+#define PROFILING_HPP
+
+
+#include <cstdint>
+#include <string>
+#include <map>
+#include <vector>
+#include <mutex>
+#include <x86intrin.h>
+
+#include "logging.hpp"
+
+
+// Helper macros for pasting the line number into the timer variable name
+#define _PROFILE_CONCAT_INNER(a, b) a##b
+#define _PROFILE_CONCAT(a, b) _PROFILE_CONCAT_INNER(a, b)
+
+
+/**
+ * @brief Scoped timer macro. Records the cycles spent between this statement and the end of the scope
+ * @details Expands to nothing unless ENABLE_PROFILING is defined
+ * @param label  The label under which the measurement is aggregated
+ * @returns      Void
+ */
+#ifdef ENABLE_PROFILING
+  #define PROFILE_SCOPE(label) quantpy::cpp::profiling::ScopedTimer _PROFILE_CONCAT(_profileTimer, __LINE__)(label);
+#else
+  #define PROFILE_SCOPE(label)
+#endif
+
+
+/**
+ * @brief Scoped timer macro using the enclosing function name as the label
+ * @see PROFILE_SCOPE() for more info
+ * @returns Void
+ */
+#define PROFILE_FUNCTION() PROFILE_SCOPE(__func__)
+
+
+/**
+ * @brief Macro for reporting the aggregated measurements of all threads
+ * @details Expands to nothing unless ENABLE_PROFILING is defined
+ * @see report() for more info
+ * @returns Void
+ */
+#ifdef ENABLE_PROFILING
+  #define PROFILE_REPORT() { quantpy::cpp::profiling::report(); }
+#else
+  #define PROFILE_REPORT()
+#endif
+
+
+namespace quantpy {
+
+  namespace cpp {
+
+    namespace profiling {
+
+
+      /**
+       * @struct labelStats
+       * @brief Struct for holding the aggregated measurements of a single label
+       * @var labelStats::count        The number of recorded measurements
+       * @var labelStats::totalCycles  The total number of cycles recorded
+       * @var labelStats::minCycles    The smallest recorded measurement
+       * @var labelStats::maxCycles    The largest recorded measurement
+       * @var labelStats::buckets      Logarithmic latency histogram. Bucket i counts the measurements below 2^i cycles
+       */
+      typedef struct {
+        uint64_t count       = 0;
+        uint64_t totalCycles = 0;
+        uint64_t minCycles   = UINT64_MAX;
+        uint64_t maxCycles   = 0;
+        uint64_t buckets[64] = {0};
+      } labelStats;
+
+
+      /**
+       * @brief Accessor for the mutex guarding the shared registry structures
+       * @returns A reference to the mutex
+       */
+      inline std::mutex& _registryMutex() {
+
+        static std::mutex mutex;
+
+        return mutex;
+
+      }
+
+
+      /**
+       * @brief Accessor for the registry of the live per-thread record maps
+       * @returns A reference to the registry
+       */
+      inline std::vector<const std::map<std::string, labelStats>*>& _registry() {
+
+        static std::vector<const std::map<std::string, labelStats>*> registry;
+
+        return registry;
+
+      }
+
+
+      /**
+       * @brief Accessor for the records merged from already exited threads
+       * @returns A reference to the merged records
+       */
+      inline std::map<std::string, labelStats>& _finishedRecords() {
+
+        static std::map<std::string, labelStats> records;
+
+        return records;
+
+      }
+
+
+      /**
+       * @brief Merges the measurements of a single label into an aggregate
+       * @param into  The aggregate statistics merged into
+       * @param from  The statistics merged from
+       * @returns     Void
+       */
+      inline void _mergeStats(labelStats& into, const labelStats& from) {
+
+        into.count       += from.count;
+        into.totalCycles += from.totalCycles;
+        into.minCycles    = from.minCycles < into.minCycles ? from.minCycles : into.minCycles;
+        into.maxCycles    = from.maxCycles > into.maxCycles ? from.maxCycles : into.maxCycles;
+
+        for (int i = 0; i < 64; i++) {
+          into.buckets[i] += from.buckets[i];
+        }
+
+      }
+
+
+      /**
+       * @brief Wrapper holding the records of a single thread
+       * @details Registers the record map on construction and on thread exit merges the records
+       * into the shared finished records, so measurements from short-lived threads survive until
+       * the end-of-run report
+       */
+      class _ThreadRecords {
+
+        public:
+
+          std::map<std::string, labelStats> records;  /**< The per-label records of the thread */
+
+
+          /**
+           * @brief Default constructor. Registers the record map
+           * @returns  Initialized _ThreadRecords object
+           */
+          _ThreadRecords() {
+
+            std::lock_guard<std::mutex> lock(_registryMutex());
+            _registry().push_back(&records);
+
+          }
+
+
+          /**
+           * @brief Destructor. Merges the records into the shared finished records
+           */
+          ~_ThreadRecords() {
+
+            std::lock_guard<std::mutex> lock(_registryMutex());
+
+            for (const auto& [label, stats] : records) {
+              _mergeStats(_finishedRecords()[label], stats);
+            }
+
+            std::vector<const std::map<std::string, labelStats>*>& registry = _registry();
+
+            for (int i = 0; i < (int)registry.size(); i++) {
+              if ( registry[i] == &records ) {
+                registry.erase(registry.begin() + i);
+                break;
+              }
+            }
+
+          }
+
+      };
+
+
+      /**
+       * @brief Accessor for the record map of the calling thread
+       * @returns A reference to the record map
+       */
+      inline std::map<std::string, labelStats>& _threadRecords() {
+
+        static thread_local _ThreadRecords records;
+
+        return records.records;
+
+      }
+
+
+      /**
+       * @brief Records a single measurement under the given label
+       * @details Only touches the thread-local records, so concurrent measurements never contend
+       * @param label   The label under which the measurement is aggregated
+       * @param cycles  The measured number of cycles
+       * @returns       Void
+       */
+      inline void _record(const char* label, uint64_t cycles) {
+
+        labelStats& stats = _threadRecords()[label];
+
+        stats.count++;
+        stats.totalCycles += cycles;
+        stats.minCycles = cycles < stats.minCycles ? cycles : stats.minCycles;
+        stats.maxCycles = cycles > stats.maxCycles ? cycles : stats.maxCycles;
+
+        int bucket = cycles == 0 ? 0 : 64 - __builtin_clzll(cycles);
+        stats.buckets[bucket]++;
+
+      }
+
+
+      /**
+       * @brief RAII timer recording the cycles its enclosing scope takes
+       * @details Reads the time stamp counter on construction and destruction. The counter read
+       * costs some tens of cycles, so the overhead is negligible for anything but the very
+       * tightest inner loops
+       * @see PROFILE_SCOPE() and PROFILE_FUNCTION() macros for usage
+       */
+      class ScopedTimer {
+
+        protected:
+
+          const char* _label;  /**< The label under which the measurement is aggregated */
+          uint64_t _start;     /**< The cycle counter value at the start of the scope */
+
+        public:
+
+          /**
+           * @brief Main constructor. Starts the measurement
+           * @param label  The label under which the measurement is aggregated
+           * @returns      Initialized ScopedTimer object
+           */
+          ScopedTimer(const char* label) : _label(label), _start(__rdtsc()) {  }
+
+
+          /**
+           * @brief Destructor. Stops the measurement and records it
+           */
+          ~ScopedTimer() {
+
+            _record(_label, __rdtsc() - _start);
+
+          }
+
+      };
+
+
+      /**
+       * @brief Reports the measurements aggregated over all of the threads
+       * @details For each label the call count, total and mean cycles, the extremes and the
+       * populated histogram buckets are printed. Typically called once at the end of the run
+       * via the PROFILE_REPORT macro
+       * @returns Void
+       */
+      inline void report() {
+
+        std::lock_guard<std::mutex> lock(_registryMutex());
+
+        // Merge the finished and the still live records per label
+        std::map<std::string, labelStats> merged = _finishedRecords();
+
+        for (const auto* threadRecords : _registry()) {
+          for (const auto& [label, stats] : *threadRecords) {
+            _mergeStats(merged[label], stats);
+          }
+        }
+
+        if ( merged.size() == 0 ) {
+          INFO("No measurements recorded");
+          return;
+        }
+
+        for (const auto& [label, stats] : merged) {
+
+          INFO(label, " - count ", stats.count, " | total ", stats.totalCycles, " cycles | mean ",
+               stats.totalCycles / stats.count, " cycles | min ", stats.minCycles, " cycles | max ",
+               stats.maxCycles, " cycles");
+
+          for (int i = 0; i < 64; i++) {
+            if ( stats.buckets[i] > 0 ) {
+              INFO(label, " - < 2^", i, " cycles: ", stats.buckets[i]);
+            }
+          }
+
+        }
+
+      }
+
+
+    }
+
+  }
+
+}
+
+
+#endif
@@ -0,0 +1,84 @@
+/**
+ * @file reduction.hpp
+ * @brief Deterministic parallel reduction utilities
+ * @details Dependent on the 'logging.hpp' header file
+ * @author Kasper Rantamäki
+ * @date 2026-08-29
+ */
+
+#ifndef REDUCTION_HPP
+#define REDUCTION_HPP
+
+
+#include <vector>
+#include <omp.h>
+
+#include "logging.hpp"
+
+
+namespace quantpy {
+
+  namespace cpp {
+
+    namespace reduction {
+
+
+      /**
+       * @brief Sums the terms of a sequence across the OpenMP threads deterministically
+       * @details Replaces the hand-rolled pattern of thread-local partial sums merged inside a
+       * critical section. Each thread accumulates its statically scheduled chunk of the index
+       * range into its own slot, after which the partials are combined with a fixed-order pairwise
+       * tree reduction. Since both the chunk assignment and the combination order are fixed for a
+       * given thread count, repeated runs produce bit-identical sums — unlike the critical section
+       * merge, whose ordering depends on thread arrival. The term functor is taken as a template
+       * parameter so that it can be inlined into the accumulation loop
+       * @tparam T     The template type. Should be some floating point type
+       * @tparam Func  The type of the term functor. Should be callable as T(int)
+       * @param n      The number of terms in the sequence
+       * @param term   The functor evaluating the i:th term
+       * @returns      The sum of the terms
+       */
+      template <typename T, typename Func>
+      T parallelSum(int n, Func term) {
+
+        if ( n < 0 ) {
+          ERROR("The number of terms can not be negative! (", n, " < 0)");
+        }
+
+        int maxThreads = omp_get_max_threads();
+
+        // One partial sum slot per thread. Written by the owning thread only
+        std::vector<T> partials(maxThreads, (T)0.);
+
+        #pragma omp parallel
+        {
+          T threadSum = (T)0.;
+
+          #pragma omp for schedule(static) nowait
+          for (int i = 0; i < n; i++) {
+            threadSum += term(i);
+          }
+
+          partials[omp_get_thread_num()] = threadSum;
+        }
+
+        // Combine the partials with a fixed-order pairwise tree reduction
+        for (int stride = 1; stride < maxThreads; stride *= 2) {
+          for (int i = 0; i + stride < maxThreads; i += 2 * stride) {
+            partials[i] += partials[i + stride];
+          }
+        }
+
+        return partials[0];
+
+      }
+
+
+    }
+
+  }
+
+}
+
+
+#endif
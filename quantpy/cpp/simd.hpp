@@ -1,6 +1,11 @@
 /**
  * @file simd.hpp
  * @brief SIMD (Single Instruction Multiple Data) utility functions
+ * @details The vector width defaults to 'SIMD_SIZE' bytes but can be overridden per translation
+ * unit at compile time or per kernel through the width template parameter. For binaries that need
+ * to serve machines of different vector widths, the runtime detection and dispatch helpers below
+ * let width-templated kernels be compiled in multiple variants and bound to function pointers once
+ * at startup, so one artifact runs at the full vector width of every host
  * @author Kasper Rantamäki
  * @date 2026-01-10
  */
@@ -10,10 +15,13 @@
 
 
 /**
- * @brief The size of the SIMD vectors in bytes
- * @todo Instead of hardcoding this it should be alterable at least at compile time
+ * @brief The default size of the SIMD vectors in bytes
+ * @details Guarded so the width can be chosen at compile time, e.g. with -DSIMD_SIZE=64 on
+ * machines built with AVX-512 support
  */
-#define SIMD_SIZE 32  // Bytes
+#ifndef SIMD_SIZE
+  #define SIMD_SIZE 32  // Bytes
+#endif
 
 
 namespace quantpy {
@@ -26,24 +34,27 @@ namespace quantpy {
       /**
        * @struct simd
        * @brief Templated struct for SIMD vectors
-       * @tparam T  The type held in the SIMD vector
+       * @tparam T       The type held in the SIMD vector
+       * @tparam nBytes  The size of the SIMD vector in bytes. Defaults to 'SIMD_SIZE', so existing
+       * 'simd<T>' usage keeps its meaning while width-templated kernels can instantiate the vector
+       * at several widths within one translation unit
        * @var simd::data The actual SIMD vector held within the struct
        */
-      template <typename T>
+      template <typename T, int nBytes = SIMD_SIZE>
       struct simd {
 
-        typedef T data __attribute__ ((__vector_size__ (SIMD_SIZE)));
+        typedef T data __attribute__ ((__vector_size__ (nBytes)));
 
       };
 
 
       /**
        * @brief Template function that chooses either the vectorized or non-vectorized datatype based on a boolean flag.
-       * @details Does the choice at compile time and is thus similar to std::conditional_t, but doesn't evaluate the 
+       * @details Does the choice at compile time and is thus similar to std::conditional_t, but doesn't evaluate the
        * unchosen option.
        * @tparam T          The type held in the SIMD vector
        * @tparam vectorize  Boolean flag telling if a SIMD vector type is to be returned
-       * @returns           Uninitialized instance of the type T or a SIMD vector holding type T depending on the 
+       * @returns           Uninitialized instance of the type T or a SIMD vector holding type T depending on the
        * value of the 'vectorize' template parameter
        */
       template <typename T, bool vectorize>
@@ -61,6 +72,83 @@ namespace quantpy {
       }
 
 
+      /**
+       * @brief Detects the widest SIMD vector size supported by the running CPU
+       * @details Queried through the compiler CPU feature builtins. To be called once by
+       * 'supportedSimdSize', which caches the answer
+       * @returns The widest supported vector size in bytes
+       */
+      inline int __detectSimdSize() {
+
+        #if defined(__x86_64__) || defined(__i386__)
+
+          if ( __builtin_cpu_supports("avx512f") ) {
+            return 64;
+          }
+
+          if ( __builtin_cpu_supports("avx") ) {
+            return 32;
+          }
+
+          if ( __builtin_cpu_supports("sse2") ) {
+            return 16;
+          }
+
+        #endif
+
+        return (int)sizeof(double);
+
+      }
+
+
+      /**
+       * @brief The widest SIMD vector size supported by the running CPU in bytes
+       * @details The detection runs once on the first call and the cached answer is returned
+       * afterwards, so the function can sit on hot dispatch paths
+       * @returns The widest supported vector size in bytes
+       */
+      inline int supportedSimdSize() {
+
+        static const int size = __detectSimdSize();
+
+        return size;
+
+      }
+
+
+      /**
+       * @brief Binds a function pointer to the widest kernel variant the running CPU supports
+       * @details The intended use compiles a width-templated kernel at several vector sizes and
+       * selects between them once at startup:
+       * > static auto kernel = dispatch(&kernel512<double>, &kernel256<double>, &kernelScalar<double>);
+       * The 512 byte variant is picked on AVX-512 hosts, the 256 byte one on AVX hosts and the
+       * fallback everywhere else, so a single binary runs at the full vector width of each machine
+       * in a heterogeneous fleet. Note that the wide variants must be compiled with the matching
+       * target options for the selection to pay off
+       * @tparam FuncPtr      The function pointer type shared by the variants
+       * @param avx512Func    The kernel variant compiled for 64 byte vectors
+       * @param avx256Func    The kernel variant compiled for 32 byte vectors
+       * @param fallbackFunc  The kernel variant safe on any host
+       * @returns             The widest supported kernel variant
+       */
+      template <typename FuncPtr>
+      FuncPtr dispatch(FuncPtr avx512Func, FuncPtr avx256Func, FuncPtr fallbackFunc) {
+
+        int size = supportedSimdSize();
+
+        if ( size >= 64 ) {
+          return avx512Func;
+        }
+
+        if ( size >= 32 ) {
+          return avx256Func;
+        }
+
+        return fallbackFunc;
+
+      }
+
+
     }
 
   }
@@ -68,4 +156,4 @@ namespace quantpy {
 }
 
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,308 @@
+/**
+ * @file taskPool.hpp
+ * @brief Work-stealing task pool for heterogeneous workloads
+ * @details The OpenMP loops used inside the individual pricers share work statically, which leaves
+ * cores idle when the jobs differ wildly in size — e.g. a book of microsecond analytic pricings
+ * mixed with multi-second Monte Carlo jobs. The pool instead gives each worker its own task deque:
+ * a worker pushes and pops at the back of its own deque and steals from the front of another's when
+ * it runs dry, so large jobs migrate to idle cores automatically. Tasks may themselves submit and
+ * wait on subtasks; waiting threads execute pending tasks instead of blocking, which both enables
+ * nested parallelism and avoids deadlocks. Completion is exposed through std::future.
+ * Dependent on the 'logging.hpp' header file
+ * @author Kasper Rantamäki
+ * @date 2026-08-29
+ */
+
+#ifndef TASK_POOL_HPP
+#define TASK_POOL_HPP
+
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "logging.hpp"
+
+
+namespace quantpy {
+
+  namespace cpp {
+
+    namespace taskPool {
+
+
+      /**
+       * @brief Work-stealing task pool with a futures-style completion API
+       * @details See the file level documentation for the overall design. The deques are guarded by
+       * per-worker mutexes: the critical sections only cover the push and pop of a single task
+       * pointer, so contention stays negligible next to any nontrivial task body
+       */
+      class TaskPool {
+
+        protected:
+
+          /**
+           * @struct workerQueue
+           * @brief Struct for holding the task deque of a single worker
+           * @var workerQueue::mutex  The mutex guarding the deque
+           * @var workerQueue::tasks  The task deque. Owner operates at the back, thieves at the front
+           */
+          typedef struct {
+            std::mutex mutex;
+            std::deque<std::function<void ()>> tasks;
+          } workerQueue;
+
+
+          std::vector<std::unique_ptr<workerQueue>> _queues;  /**< The per-worker task deques */
+          std::vector<std::thread> _workers;                  /**< The worker threads */
+          std::atomic<bool> _running{false};                  /**< Boolean flag keeping the workers alive */
+          std::atomic<uint64_t> _submitCount{0};              /**< Counter used to spread external submissions over the deques */
+
+
+          /**
+           * @brief Accessor for the pool the calling thread works for
+           * @returns A reference to the pool pointer. Null for threads outside any pool
+           */
+          static TaskPool*& _currentPool() {
+
+            static thread_local TaskPool* pool = nullptr;
+
+            return pool;
+
+          }
+
+
+          /**
+           * @brief Accessor for the worker index of the calling thread within its pool
+           * @returns A reference to the worker index. Meaningless for threads outside any pool
+           */
+          static int& _workerId() {
+
+            static thread_local int id = 0;
+
+            return id;
+
+          }
+
+
+          /**
+           * @brief Tries to acquire and run a single task
+           * @details First pops from the back of the preferred deque and then tries to steal from
+           * the front of the others in order
+           * @param preferred  The index of the deque tried first, i.e. the caller's own deque
+           * @returns          Boolean flag telling if a task was run
+           */
+          bool _tryRun(int preferred) {
+
+            std::function<void ()> task;
+
+            {
+              workerQueue& own = *this->_queues[preferred];
+              std::lock_guard<std::mutex> lock(own.mutex);
+
+              if ( !own.tasks.empty() ) {
+                task = std::move(own.tasks.back());
+                own.tasks.pop_back();
+              }
+            }
+
+            if ( !task ) {
+
+              for (int i = 0; i < (int)this->_queues.size() && !task; i++) {
+
+                if ( i == preferred ) {
+                  continue;
+                }
+
+                workerQueue& victim = *this->_queues[i];
+                std::lock_guard<std::mutex> lock(victim.mutex);
+
+                if ( !victim.tasks.empty() ) {
+                  task = std::move(victim.tasks.front());
+                  victim.tasks.pop_front();
+                }
+
+              }
+
+            }
+
+            if ( task ) {
+              task();
+              return true;
+            }
+
+            return false;
+
+          }
+
+
+          /**
+           * @brief The main loop of a worker thread
+           * @param id  The index of the worker within the pool
+           * @returns   Void
+           */
+          void _workerLoop(int id) {
+
+            _currentPool() = this;
+            _workerId() = id;
+
+            while ( this->_running.load(std::memory_order_acquire) ) {
+
+              if ( !this->_tryRun(id) ) {
+                std::this_thread::sleep_for(std::chrono::microseconds(100));
+              }
+
+            }
+
+          }
+
+        public:
+
+          /**
+           * @brief Main constructor. Spawns the worker threads
+           * @param nWorkers  The number of worker threads. Defaults to the hardware concurrency
+           * @returns         Initialized TaskPool object
+           */
+          TaskPool(int nWorkers = (int)std::thread::hardware_concurrency()) {
+
+            if ( nWorkers < 1 ) {
+              ERROR("The number of workers must be positive! (", nWorkers, " < 1)");
+            }
+
+            this->_queues.reserve(nWorkers);
+
+            for (int i = 0; i < nWorkers; i++) {
+              this->_queues.push_back(std::make_unique<workerQueue>());
+            }
+
+            this->_running.store(true, std::memory_order_release);
+
+            this->_workers.reserve(nWorkers);
+
+            for (int i = 0; i < nWorkers; i++) {
+              this->_workers.emplace_back(&TaskPool::_workerLoop, this, i);
+            }
+
+          }
+
+
+          /**
+           * @brief Destructor. Drains the remaining tasks and joins the workers
+           */
+          ~TaskPool() {
+
+            // Let the workers finish what is queued before stopping them
+            bool tasksLeft = true;
+
+            while ( tasksLeft ) {
+
+              tasksLeft = false;
+
+              for (const auto& queue : this->_queues) {
+                std::lock_guard<std::mutex> lock(queue->mutex);
+                tasksLeft = tasksLeft || !queue->tasks.empty();
+              }
+
+              if ( tasksLeft ) {
+                std::this_thread::sleep_for(std::chrono::microseconds(100));
+              }
+
+            }
+
+            this->_running.store(false, std::memory_order_release);
+
+            for (std::thread& worker : this->_workers) {
+              worker.join();
+            }
+
+          }
+
+
+          /**
+           * @brief Getter for the number of worker threads
+           * @returns The number of worker threads
+           */
+          int nWorkers() const { return (int)this->_workers.size(); }
+
+
+          /**
+           * @brief Submits a task into the pool
+           * @details A submission from within a worker of this pool lands at the back of that
+           * worker's own deque, keeping nested subtasks hot in its cache until someone steals them.
+           * External submissions are spread over the deques round-robin
+           * @tparam Func  The type of the task functor. Should be callable with no arguments
+           * @param func   The task functor
+           * @returns      A std::future completing with the return value of the task
+           */
+          template <typename Func>
+          auto submit(Func func) -> std::future<decltype(func())> {
+
+            using resultType = decltype(func());
+
+            // The packaged task is shared as std::function requires a copyable callable
+            auto task = std::make_shared<std::packaged_task<resultType ()>>(std::move(func));
+            std::future<resultType> future = task->get_future();
+
+            int target;
+
+            if ( _currentPool() == this ) {
+              target = _workerId();
+            }
+            else {
+              target = (int)(this->_submitCount.fetch_add(1, std::memory_order_relaxed) % this->_queues.size());
+            }
+
+            {
+              workerQueue& queue = *this->_queues[target];
+              std::lock_guard<std::mutex> lock(queue.mutex);
+              queue.tasks.push_back([task]() { (*task)(); });
+            }
+
+            return future;
+
+          }
+
+
+          /**
+           * @brief Waits on a future, executing pending tasks instead of blocking
+           * @details This is what makes nested parallelism safe: a task waiting on its subtasks
+           * keeps draining the deques, so the pool can not deadlock with every worker waiting
+           * @tparam R      The result type of the future
+           * @param future  The future waited on
+           * @returns       The result of the future
+           */
+          template <typename R>
+          R wait(std::future<R>& future) {
+
+            int preferred = _currentPool() == this ? _workerId() : 0;
+
+            while ( future.wait_for(std::chrono::seconds(0)) != std::future_status::ready ) {
+
+              if ( !this->_tryRun(preferred) ) {
+                std::this_thread::sleep_for(std::chrono::microseconds(100));
+              }
+
+            }
+
+            return future.get();
+
+          }
+
+      };
+
+
+    }
+
+  }
+
+}
+
+
+#endif
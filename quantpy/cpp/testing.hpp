@@ -14,6 +14,9 @@
 #include <chrono>
 #include <exception>
 #include <filesystem>
+#include <fstream>
+#include <algorithm>
+#include <omp.h>
 
 #include "logging.hpp"
 #include "utils.hpp"
@@ -112,10 +115,15 @@ namespace quantpy {
 
           /**
            * @brief Method for running the tests in the test suite
+           * @details In the parallel mode the tests are scheduled dynamically across the OpenMP threads,
+           * which the independence of the test functions allows, and the results are reported in the
+           * declaration order once all of the tests have finished. Note that the timings of tests that
+           * are themselves parallel are distorted when they share the threads with other tests
            * @param showTestInfo  Boolean flag telling if the test submodule and name gets printed
+           * @param parallel      Boolean flag telling if the tests are run in parallel. Defaults to 'false'
            * @returns             True if all of the tests pass, false otherwise
            */
-          bool runTests(bool showTestInfo = false) {
+          bool runTests(bool showTestInfo = false, bool parallel = false) {
 
             INFO("Running tests for: ", testSuiteName);
 
@@ -124,8 +132,64 @@ namespace quantpy {
               return true;
             }
 
+            if ( parallel ) {
+
+              int nTests = this->numTests();
+
+              // Per test: 1 for passed, 0 for failed and -1 for an exception
+              std::vector<int> status(nTests);
+              std::vector<int> times(nTests);
+              std::vector<std::string> errors(nTests);
+
+              #pragma omp parallel for schedule(dynamic)
+              for (int i = 0; i < nTests; i++) {
+
+                try {
+                  const auto start = std::chrono::high_resolution_clock::now();
+                  bool passed = testStructs[i].test();
+                  const auto end = std::chrono::high_resolution_clock::now();
+
+                  const auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(end - start);
+
+                  status[i] = passed ? 1 : 0;
+                  times[i]  = (int)duration.count();
+                }
+                catch (std::exception& e) {  // Note, doesn't catch hardware exceptions like segmentation fault
+                  status[i] = -1;
+                  errors[i] = e.what();
+                }
+
+              }
+
+              // Report the results coherently in the declaration order
+              int countPassedParallel = 0;
+
+              for (int i = 0; i < nTests; i++) {
+
+                std::string infoString = "";
+                if ( showTestInfo ) {
+                  infoString = utils::formString(" ", testStructs[i].submodule, "|", testStructs[i].testname);
+                }
+
+                if ( status[i] == -1 ) {
+                  INFO("Test ", i + 1, infoString, " - ERROR (", errors[i], ")\n");
+                }
+                else if ( status[i] == 1 ) {
+                  countPassedParallel++;
+                  INFO("Test ", i + 1, infoString, " - PASSED (time taken ", times[i], " ms)");
+                }
+                else {
+                  INFO("Test ", i + 1, infoString, " - FAILED (time taken ", times[i], " ms)");
+                }
+
+              }
+
+              return ( countPassedParallel == nTests );
+
+            }
+
             int countPassed = 0;
-          
+
             for (int i = 0; i < this->numTests(); i++) {
               testStruct test_i = testStructs[i];
               bool passed;
@@ -165,6 +229,271 @@ namespace quantpy {
       };
 
 
+      /**
+       * @brief Benchmark suite for holding and running benchmark functions
+       * @details Complements the TestSuite for performance work: where the TestSuite times each test
+       * once at millisecond resolution, the BenchmarkSuite runs warmup iterations followed by repeated
+       * timed batches at nanosecond resolution and reports ns/op and ops/sec percentiles. The achieved
+       * medians can be written to a baseline file and later runs compared against it, so that a
+       * performance regression fails the run just like a failing test would
+       */
+      class BenchmarkSuite {
+
+        protected:
+
+          /**
+           * @brief Alias for the benchmark functions
+           * @details Benchmark functions are assumed to be independent of the suite, take no parameters
+           * and perform one operation per call
+           */
+          using benchmarkFunction = std::function<void()>;
+
+
+          /**
+           * @struct benchmarkStruct
+           * @brief Struct for holding individual benchmark info
+           * @var benchmarkStruct::benchmark      The benchmark function itself
+           * @var benchmarkStruct::benchmarkName  The name of the benchmark
+           */
+          typedef struct {
+            benchmarkFunction benchmark;
+            std::string benchmarkName;
+          } benchmarkStruct;
+
+
+          std::vector<benchmarkStruct> benchmarkStructs;  /**< The list of function references */
+          std::string benchmarkSuiteName = "undefined";   /**< The name of the benchmark suite */
+          std::vector<double> medians;                    /**< The median ns/op achieved by the latest run */
+
+          int nWarmup  = 10;   /**< The number of warmup calls before the timed repeats */
+          int nRepeats = 100;  /**< The number of timed repeats */
+          int nPerRepeat = 1;  /**< The number of calls timed per repeat. Should be raised for sub-microsecond operations */
+
+
+          /**
+           * @brief Picks a percentile from an already sorted sample
+           * @param sorted  The sorted sample
+           * @param p       The wanted percentile on the interval [0, 1]
+           * @returns       The value at the wanted percentile
+           */
+          static double percentile(const std::vector<double>& sorted, double p) {
+
+            int idx = (int)(p * (double)(sorted.size() - 1));
+
+            return sorted[idx];
+
+          }
+
+        public:
+
+          /**
+           * @brief Default constructor. Leaves the name of the benchmark suite undefined
+           */
+          BenchmarkSuite(void) { }
+
+
+          /**
+           * @brief Constructor that allows specifying the name of the suite and the repetition counts
+           * @param name        Constant string pointer with the name of the benchmark suite
+           * @param nWarmup     The number of warmup calls before the timed repeats. Defaults to 10
+           * @param nRepeats    The number of timed repeats. Defaults to 100
+           * @param nPerRepeat  The number of calls timed per repeat. Defaults to 1 and should be raised
+           * for operations shorter than the clock resolution
+           */
+          BenchmarkSuite(const std::string& name, int nWarmup = 10, int nRepeats = 100, int nPerRepeat = 1) {
+
+            if ( nWarmup < 0 ) {
+              ERROR("The number of warmup calls can not be negative! (", nWarmup, " < 0)");
+            }
+
+            if ( nRepeats < 1 || nPerRepeat < 1 ) {
+              ERROR("The repeat counts need to be positive! (", nRepeats, ", ", nPerRepeat, ")");
+            }
+
+            this->benchmarkSuiteName = name;
+            this->nWarmup    = nWarmup;
+            this->nRepeats   = nRepeats;
+            this->nPerRepeat = nPerRepeat;
+
+          }
+
+
+          /**
+           * @brief Method for adding a function pointer to the benchmark suite
+           * @param function       The benchmark function to be added to the suite
+           * @param benchmarkName  The name of the benchmark. Defaults to 'undefined'
+           * @returns              True if the benchmark was added successfully
+           */
+          bool addBenchmark(benchmarkFunction function, std::string benchmarkName = "undefined") {
+
+            benchmarkStruct newBenchmark;
+
+            newBenchmark.benchmark = function;
+            newBenchmark.benchmarkName = benchmarkName;
+
+            benchmarkStructs.push_back(newBenchmark);
+            return true;
+
+          }
+
+
+          /**
+           * @brief Method that gives the number of benchmarks currently in the suite
+           * @returns The number of benchmarks in the suite
+           */
+          int numBenchmarks() {
+
+            return benchmarkStructs.size();
+
+          }
+
+
+          /**
+           * @brief Method for running the benchmarks in the suite
+           * @details Each benchmark is first called 'nWarmup' times without timing and then 'nRepeats'
+           * times with each repeat timing 'nPerRepeat' calls at nanosecond resolution. The minimum,
+           * median, 90th percentile and maximum ns/op are reported together with the ops/sec implied
+           * by the median. The medians are stored for the baseline methods
+           * @returns True if all of the benchmarks ran without exceptions, false otherwise
+           */
+          bool runBenchmarks() {
+
+            INFO("Running benchmarks for: ", benchmarkSuiteName);
+
+            if ( this->numBenchmarks() == 0 ) {
+              INFO("No benchmarks defined");
+              return true;
+            }
+
+            medians.clear();
+
+            bool allRan = true;
+
+            for (int i = 0; i < this->numBenchmarks(); i++) {
+              benchmarkStruct benchmark_i = benchmarkStructs[i];
+
+              std::vector<double> samples(nRepeats);
+
+              try {
+                for (int j = 0; j < nWarmup; j++) {
+                  benchmark_i.benchmark();
+                }
+
+                for (int j = 0; j < nRepeats; j++) {
+                  const auto start = std::chrono::high_resolution_clock::now();
+                  for (int l = 0; l < nPerRepeat; l++) {
+                    benchmark_i.benchmark();
+                  }
+                  const auto end = std::chrono::high_resolution_clock::now();
+
+                  const auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start);
+                  samples[j] = (double)duration.count() / (double)nPerRepeat;
+                }
+              }
+              catch (std::exception& e) {  // Note, doesn't catch hardware exceptions like segmentation fault
+                INFO("Benchmark ", i + 1, " (", benchmark_i.benchmarkName, ") - ERROR (", e.what(), ")\n");
+                medians.push_back(-1.);
+                allRan = false;
+                continue;
+              }
+
+              std::sort(samples.begin(), samples.end());
+
+              double median = percentile(samples, 0.5);
+              medians.push_back(median);
+
+              INFO("Benchmark ", i + 1, " (", benchmark_i.benchmarkName, ") - min ", samples[0],
+                   " ns/op | p50 ", median, " ns/op | p90 ", percentile(samples, 0.9),
+                   " ns/op | max ", samples[samples.size() - 1], " ns/op | ", 1e9 / median, " ops/sec");
+            }
+
+            return allRan;
+
+          }
+
+
+          /**
+           * @brief Method for writing the achieved median timings into a baseline file
+           * @details The file holds one benchmark per line as '<name> <median ns/op>'. The benchmarks
+           * need to have been run before the baseline can be written
+           * @param filepath  Constant string pointer with the path to the baseline file
+           * @returns         True if the baseline was written successfully
+           */
+          bool writeBaseline(const std::string& filepath) {
+
+            if ( medians.size() == 0 ) {
+              ERROR("The benchmarks need to be run before a baseline can be written!");
+            }
+
+            std::ofstream file(filepath);
+
+            if ( !file ) {
+              ERROR("Couldn't open the given file!");
+            }
+
+            for (int i = 0; i < this->numBenchmarks(); i++) {
+              file << benchmarkStructs[i].benchmarkName << " " << medians[i] << "\n";
+            }
+
+            file.close();
+
+            INFO("Baseline written to: ", filepath);
+
+            return true;
+
+          }
+
+
+          /**
+           * @brief Method for comparing the achieved median timings against a baseline file
+           * @details The benchmarks need to have been run before the comparison can be made. A benchmark
+           * is considered regressed if its median exceeds the baseline by more than the given factor,
+           * in which case the comparison fails just like a failing test would fail a test run
+           * @param filepath   Constant string pointer with the path to the baseline file
+           * @param tolerance  The allowed slowdown factor over the baseline. Defaults to 1.2
+           * @returns          True if no benchmark regressed past the tolerance, false otherwise
+           */
+          bool compareBaseline(const std::string& filepath, double tolerance = 1.2) {
+
+            if ( medians.size() == 0 ) {
+              ERROR("The benchmarks need to be run before a baseline comparison can be made!");
+            }
+
+            std::ifstream file(filepath);
+
+            if ( !file ) {
+              ERROR("Couldn't open the given file!");
+            }
+
+            bool noRegressions = true;
+
+            std::string name;
+            double baselineMedian;
+            int i = 0;
+
+            while ( file >> name >> baselineMedian && i < this->numBenchmarks() ) {
+
+              if ( medians[i] > baselineMedian * tolerance ) {
+                INFO("Benchmark ", i + 1, " (", name, ") - REGRESSED (", medians[i], " ns/op > ",
+                     tolerance, " * ", baselineMedian, " ns/op)");
+                noRegressions = false;
+              }
+              else {
+                INFO("Benchmark ", i + 1, " (", name, ") - OK (", medians[i], " ns/op vs baseline ", baselineMedian, " ns/op)");
+              }
+
+              i++;
+            }
+
+            file.close();
+
+            return noRegressions;
+
+          }
+
+      };
+
+
     }
 
   }
@@ -0,0 +1,175 @@
+/**
+ * @file evalCache_tests.cpp
+ * @brief Definition of tests for the open-addressing evaluation cache
+ * @details Compile in the main quantpy directory with:
+ * > g++ -std=c++17 -mavx -fopenmp -Wall quantpy/cpp/tests/evalCache_tests.cpp -lm -o evalCache_tests.o
+ * Run with:
+ * > ./evalCache_tests.o
+ * @author Kasper Rantamäki
+ * @date 2026-08-29
+ */
+
+
+#include <cmath>
+
+#include "../evalCache.hpp"
+#include "../testing.hpp"
+#include "../logging.hpp"
+
+
+#ifndef TEST_TOL
+  #define TEST_TOL 1e-12
+#endif
+
+
+namespace quantpy {
+
+  namespace cpp {
+
+    namespace evalCache_tests {
+
+
+      // Test 1
+      bool test_lookup1() {
+
+        evalCache::EvalCache<double, 4> cache;
+
+        double args[4] = {105., 1.5, 0.04, 0.2};
+        double value;
+
+        // A fresh cache misses, an inserted entry hits with the stored value
+        bool missed = !cache.lookup(args, value);
+
+        cache.insert(args, 7.25);
+
+        return missed && cache.lookup(args, value) && ( value == 7.25 );
+
+      }
+
+
+      // Test 2
+      bool test_lookup2() {
+
+        evalCache::EvalCache<double, 4> cache;
+
+        double args1[4] = {105., 1.5, 0.04, 0.2};
+        double args2[4] = {105., 1.5, 0.04, 0.25};
+        double value;
+
+        cache.insert(args1, 7.25);
+
+        // A key differing in any single argument should miss
+        return !cache.lookup(args2, value);
+
+      }
+
+
+      // Test 3
+      bool test_quantization1() {
+
+        evalCache::EvalCache<double, 2> cache(1e-9);
+
+        double args1[2] = {105., 1.5};
+        double args2[2] = {105. + 1e-11, 1.5};
+        double args3[2] = {105. + 1e-6, 1.5};
+        double value;
+
+        cache.insert(args1, 7.25);
+
+        // Arguments equal up to the quantum share an entry, clearly separated ones don't
+        bool passed = cache.lookup(args2, value) && ( value == 7.25 );
+
+        return passed && !cache.lookup(args3, value);
+
+      }
+
+
+      // Test 4
+      bool test_clear1() {
+
+        evalCache::EvalCache<double, 4> cache;
+
+        double args[4] = {105., 1.5, 0.04, 0.2};
+        double value;
+
+        cache.insert(args, 7.25);
+        cache.clear();
+
+        return !cache.lookup(args, value);
+
+      }
+
+
+      // Test 5
+      bool test_overwrite1() {
+
+        evalCache::EvalCache<double, 4> cache;
+
+        double args[4] = {105., 1.5, 0.04, 0.2};
+        double value;
+
+        cache.insert(args, 7.25);
+        cache.insert(args, 7.5);
+
+        // Reinserting the same key overwrites the stored value
+        return cache.lookup(args, value) && ( value == 7.5 );
+
+      }
+
+
+      // Test 6
+      bool test_eviction1() {
+
+        evalCache::EvalCache<double, 1> cache;
+
+        double value;
+
+        // Flooding the table far past its capacity should evict entries rather than grow or fail
+        for (int i = 0; i < 10000; i++) {
+          double args[1] = {(double)i};
+          cache.insert(args, (double)i);
+        }
+
+        int hits = 0;
+
+        for (int i = 0; i < 10000; i++) {
+
+          double args[1] = {(double)i};
+
+          if ( cache.lookup(args, value) ) {
+            hits += ( value == (double)i );
+          }
+
+        }
+
+        DEBUG("Found ", hits, " entries still cached");
+
+        // The fixed size table holds at most its slot count of the most recent entries
+        return ( hits > 0 ) && ( hits <= 256 );
+
+      }
+
+
+    }
+
+  }
+
+}
+
+
+int main() {
+
+  quantpy::cpp::logging::verbosity(3);
+
+  quantpy::cpp::testing::TestSuite evalCacheTests = quantpy::cpp::testing::TestSuite("evalCache.hpp");
+
+  evalCacheTests.addTest(quantpy::cpp::evalCache_tests::test_lookup1);
+  evalCacheTests.addTest(quantpy::cpp::evalCache_tests::test_lookup2);
+  evalCacheTests.addTest(quantpy::cpp::evalCache_tests::test_quantization1);
+  evalCacheTests.addTest(quantpy::cpp::evalCache_tests::test_clear1);
+  evalCacheTests.addTest(quantpy::cpp::evalCache_tests::test_overwrite1);
+  evalCacheTests.addTest(quantpy::cpp::evalCache_tests::test_eviction1);
+
+  return (int)evalCacheTests.runTests();
+
+}
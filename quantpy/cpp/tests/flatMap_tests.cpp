@@ -0,0 +1,157 @@
+/**
+ * @file flatMap_tests.cpp
+ * @brief Definition of tests for the flat sorted-vector map
+ * @details Compile in the main quantpy directory with:
+ * > g++ -std=c++17 -mavx -fopenmp -Wall quantpy/cpp/tests/flatMap_tests.cpp -lm -o flatMap_tests.o
+ * Run with:
+ * > ./flatMap_tests.o
+ * @author Kasper Rantamäki
+ * @date 2026-08-29
+ */
+
+
+#include <cmath>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "../flatMap.hpp"
+#include "../testing.hpp"
+#include "../logging.hpp"
+
+
+#ifndef TEST_TOL
+  #define TEST_TOL 1e-12
+#endif
+
+
+namespace quantpy {
+
+  namespace cpp {
+
+    namespace flatMap_tests {
+
+
+      // Test 1
+      bool test_constructor1() {
+
+        // The pairs should come out sorted by key regardless of the input order
+        std::vector<double> keys = {2., 0.5, 10., 5.};
+        std::vector<double> vals = {0.041, 0.038, 0.047, 0.044};
+
+        flatMap::FlatMap<double, double> map = flatMap::FlatMap<double, double>(keys, vals);
+
+        std::vector<double> correctKeys = {0.5, 2., 5., 10.};
+        std::vector<double> correctVals = {0.038, 0.041, 0.044, 0.047};
+
+        bool passed = ( map.size() == 4 );
+
+        for (int i = 0; i < map.size(); i++) {
+          DEBUG("Found key: ", map.keys()[i], " (value: ", map.vals()[i], ")");
+          passed = passed && ( map.keys()[i] == correctKeys[i] ) && ( map.vals()[i] == correctVals[i] );
+        }
+
+        return passed;
+
+      }
+
+
+      // Test 2
+      bool test_constructor2() {
+
+        std::map<int, std::string> testMap = {{1, "Hello"}, {2, " "}, {3, "World"}, {4, "!"}};
+
+        flatMap::FlatMap<int, std::string> map = flatMap::FlatMap<int, std::string>(testMap);
+
+        return ( map.size() == 4 ) && ( map.at(1) == "Hello" ) && ( map.at(4) == "!" );
+
+      }
+
+
+      // Test 3
+      bool test_lookup1() {
+
+        std::vector<double> keys = {0.5, 2., 5., 10.};
+        std::vector<double> vals = {0.038, 0.041, 0.044, 0.047};
+
+        flatMap::FlatMap<double, double> map = flatMap::FlatMap<double, double>(keys, vals);
+
+        return map.contains(5.) && !map.contains(3.) && ( map.at(5.) == 0.044 );
+
+      }
+
+
+      // Test 4
+      bool test_insert1() {
+
+        flatMap::FlatMap<double, double> map;
+
+        map.insert(5., 0.044);
+        map.insert(0.5, 0.038);
+        map.insert(2., 0.041);
+        map.insert(2., 0.042);  // Overwrites the existing key
+
+        return ( map.size() == 3 ) && ( map.keys()[0] == 0.5 ) && ( map.at(2.) == 0.042 );
+
+      }
+
+
+      // Test 5
+      bool test_interpolate1() {
+
+        std::vector<double> keys = {0.5, 2., 5., 10.};
+        std::vector<double> vals = {0.038, 0.041, 0.044, 0.047};
+
+        flatMap::FlatMap<double, double> map = flatMap::FlatMap<double, double>(keys, vals);
+
+        // Exact keys return the stored values and midpoints the average of the bracketing values
+        double foundExact = map.interpolate(2.);
+        double foundMid = map.interpolate(3.5);
+
+        DEBUG("Found values: ", foundExact, " and ", foundMid);
+
+        return ( fabs(foundExact - 0.041) < TEST_TOL ) && ( fabs(foundMid - 0.0425) < TEST_TOL );
+
+      }
+
+
+      // Test 6
+      bool test_views1() {
+
+        std::vector<double> keys = {0.5, 2., 5., 10.};
+        std::vector<double> vals = {0.038, 0.041, 0.044, 0.047};
+
+        flatMap::FlatMap<double, double> map = flatMap::FlatMap<double, double>(keys, vals);
+
+        // The views should reference the internal arrays rather than copies
+        const std::vector<double>& foundKeys = flatMap::mapKeys(map);
+        const std::vector<double>& foundVals = flatMap::mapVals(map);
+
+        return ( &foundKeys == &map.keys() ) && ( &foundVals == &map.vals() );
+
+      }
+
+
+    }
+
+  }
+
+}
+
+
+int main() {
+
+  quantpy::cpp::logging::verbosity(3);
+
+  quantpy::cpp::testing::TestSuite flatMapTests = quantpy::cpp::testing::TestSuite("flatMap.hpp");
+
+  flatMapTests.addTest(quantpy::cpp::flatMap_tests::test_constructor1);
+  flatMapTests.addTest(quantpy::cpp::flatMap_tests::test_constructor2);
+  flatMapTests.addTest(quantpy::cpp::flatMap_tests::test_lookup1);
+  flatMapTests.addTest(quantpy::cpp::flatMap_tests::test_insert1);
+  flatMapTests.addTest(quantpy::cpp::flatMap_tests::test_interpolate1);
+  flatMapTests.addTest(quantpy::cpp::flatMap_tests::test_views1);
+
+  return (int)flatMapTests.runTests();
+
+}
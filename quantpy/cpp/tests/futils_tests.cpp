@@ -0,0 +1,159 @@
+/**
+ * @file futils_tests.cpp
+ * @brief Definition of tests for file utility functions
+ * @details Compile in the main quantpy directory with:
+ * > g++ -std=c++17 -mavx -fopenmp -Wall quantpy/cpp/tests/futils_tests.cpp -lm -o futils_tests.o
+ * Run with:
+ * > ./futils_tests.o
+ * @author Kasper Rantamäki
+ * @date 2026-08-29
+ */
+
+
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "../futils.hpp"
+#include "../testing.hpp"
+#include "../logging.hpp"
+
+
+namespace quantpy {
+
+  namespace cpp {
+
+    namespace futils_tests {
+
+
+      /**
+       * @brief Helper writing the given contents into a temporary file
+       * @param filepath  The path of the file to be written
+       * @param contents  The contents written into the file
+       * @returns         Void
+       */
+      void writeFile(const std::string& filepath, const std::string& contents) {
+
+        std::ofstream file(filepath);
+        file << contents;
+        file.close();
+
+      }
+
+
+      // Test 1
+      bool test_mappedFile1() {
+
+        std::string filepath = "/tmp/quantpy_futils_test1.csv";
+        writeFile(filepath, "date,strike,price\n2026-08-29,100,4.2\n");
+
+        futils::MappedFile file(filepath);
+
+        DEBUG("Found size: ", file.size());
+
+        return ( file.size() == 37 ) && ( file.view() == "date,strike,price\n2026-08-29,100,4.2\n" );
+
+      }
+
+
+      // Test 2
+      bool test_mappedFile2() {
+
+        // The line iteration should yield the lines without the newline chars and without an extra
+        // empty line for the trailing newline
+        std::string filepath = "/tmp/quantpy_futils_test2.csv";
+        writeFile(filepath, "first\nsecond\nthird\n");
+
+        std::vector<std::string> correctLines = {"first", "second", "third"};
+        std::vector<std::string> foundLines;
+
+        futils::MappedFile file(filepath);
+
+        for (std::string_view line : file) {
+          foundLines.push_back(std::string(line));
+        }
+
+        bool passed = ( correctLines.size() == foundLines.size() );
+
+        for (int i = 0; i < (int)foundLines.size(); i++) {
+          DEBUG("Found line: ", foundLines[i]);
+          passed = passed && ( correctLines[i] == foundLines[i] );
+        }
+
+        return passed;
+
+      }
+
+
+      // Test 3
+      bool test_mappedFile3() {
+
+        // A file without a trailing newline should still yield its final line
+        std::string filepath = "/tmp/quantpy_futils_test3.csv";
+        writeFile(filepath, "first\nsecond");
+
+        std::vector<std::string> foundLines;
+
+        futils::MappedFile file(filepath);
+
+        for (std::string_view line : file) {
+          foundLines.push_back(std::string(line));
+        }
+
+        return ( foundLines.size() == 2 ) && ( foundLines[0] == "first" ) && ( foundLines[1] == "second" );
+
+      }
+
+
+      // Test 4
+      bool test_mappedFile4() {
+
+        std::string filepath = "/tmp/quantpy_futils_test4.csv";
+        writeFile(filepath, "first\nsecond\nthird\n");
+
+        futils::MappedFile file(filepath);
+
+        DEBUG("Found last line: ", std::string(file.lastLine()));
+
+        return ( file.lastLine() == "third" );
+
+      }
+
+
+      // Test 5
+      bool test_lastLine1() {
+
+        std::string filepath = "/tmp/quantpy_futils_test5.csv";
+        writeFile(filepath, "header\n1.0,2.0\n3.0,4.0\n");
+
+        std::stringstream foundLine = futils::lastLine(filepath);
+
+        DEBUG("Found last line: ", foundLine.str());
+
+        return ( foundLine.str() == "3.0,4.0" );
+
+      }
+
+
+    }
+
+  }
+
+}
+
+
+int main() {
+
+  quantpy::cpp::logging::verbosity(3);
+
+  quantpy::cpp::testing::TestSuite futilsTests = quantpy::cpp::testing::TestSuite("futils.hpp");
+
+  futilsTests.addTest(quantpy::cpp::futils_tests::test_mappedFile1);
+  futilsTests.addTest(quantpy::cpp::futils_tests::test_mappedFile2);
+  futilsTests.addTest(quantpy::cpp::futils_tests::test_mappedFile3);
+  futilsTests.addTest(quantpy::cpp::futils_tests::test_mappedFile4);
+  futilsTests.addTest(quantpy::cpp::futils_tests::test_lastLine1);
+
+  return (int)futilsTests.runTests();
+
+}
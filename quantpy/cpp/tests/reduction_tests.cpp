@@ -0,0 +1,107 @@
+/**
+ * @file reduction_tests.cpp
+ * @brief Definition of tests for the parallel reduction utilities
+ * @details Compile in the main quantpy directory with:
+ * > g++ -std=c++17 -mavx -fopenmp -Wall quantpy/cpp/tests/reduction_tests.cpp -lm -o reduction_tests.o
+ * Run with:
+ * > ./reduction_tests.o
+ * @author Kasper Rantamäki
+ * @date 2026-08-29
+ */
+
+
+#include <cmath>
+
+#include "../reduction.hpp"
+#include "../testing.hpp"
+#include "../logging.hpp"
+
+
+namespace quantpy {
+
+  namespace cpp {
+
+    namespace reduction_tests {
+
+
+      // Test 1
+      bool test_parallelSum1() {
+
+        int n = 1000;
+        int correctSum = n * (n + 1) / 2;
+
+        double foundSum = reduction::parallelSum<double>(n, [](int i) {
+          return (double)(i + 1);
+        });
+
+        DEBUG("Found sum: ", foundSum);
+
+        bool passed = (fabs(foundSum - (double)correctSum) < 1e-12);
+
+        return passed;
+
+      }
+
+
+      // Test 2
+      bool test_parallelSum2() {
+
+        int n = 100000;
+
+        double firstSum = reduction::parallelSum<double>(n, [](int i) {
+          return 1. / ((double)(i + 1) * (double)(i + 1));
+        });
+
+        double secondSum = reduction::parallelSum<double>(n, [](int i) {
+          return 1. / ((double)(i + 1) * (double)(i + 1));
+        });
+
+        DEBUG("Found sums: ", firstSum, " and ", secondSum);
+
+        // The fixed chunk assignment and combination order should make repeated runs bit-identical
+        bool passed = (firstSum == secondSum);
+
+        return passed;
+
+      }
+
+
+      // Test 3
+      bool test_parallelSum3() {
+
+        int n = 0;
+        double correctSum = 0.;
+
+        double foundSum = reduction::parallelSum<double>(n, [](int i) {
+          return (double)i;
+        });
+
+        DEBUG("Found sum: ", foundSum);
+
+        bool passed = (foundSum == correctSum);
+
+        return passed;
+
+      }
+
+
+    }
+
+  }
+
+}
+
+
+int main() {
+
+  quantpy::cpp::logging::verbosity(3);
+
+  quantpy::cpp::testing::TestSuite reductionTests = quantpy::cpp::testing::TestSuite("reduction.hpp");
+
+  reductionTests.addTest(quantpy::cpp::reduction_tests::test_parallelSum1);
+  reductionTests.addTest(quantpy::cpp::reduction_tests::test_parallelSum2);
+  reductionTests.addTest(quantpy::cpp::reduction_tests::test_parallelSum3);
+
+  return (int)reductionTests.runTests();
+
+}
@@ -0,0 +1,98 @@
+/**
+ * @file simd_tests.cpp
+ * @brief Definition of tests for the SIMD utilities and the runtime dispatch layer
+ * @details Compile in the main quantpy directory with:
+ * > g++ -std=c++17 -mavx -fopenmp -Wall quantpy/cpp/tests/simd_tests.cpp -lm -o simd_tests.o
+ * Run with:
+ * > ./simd_tests.o
+ * @author Kasper Rantamäki
+ * @date 2026-08-29
+ */
+
+
+#include "../simd.hpp"
+#include "../testing.hpp"
+#include "../logging.hpp"
+
+
+namespace quantpy {
+
+  namespace cpp {
+
+    namespace simd_tests {
+
+
+      // The dummy kernel variants the dispatch tests bind between
+      int __variant512() { return 64; }
+      int __variant256() { return 32; }
+      int __variantFallback() { return 8; }
+
+
+      // Test 1
+      bool test_widths1() {
+
+        // The default width should match 'SIMD_SIZE' and the width parameter override it
+        bool passed = ( sizeof(typename simd::simd<double>::data) == SIMD_SIZE );
+
+        passed = passed && ( sizeof(typename simd::simd<double, 16>::data) == 16 );
+        passed = passed && ( sizeof(typename simd::simd<float, 64>::data) == 64 );
+
+        return passed;
+
+      }
+
+
+      // Test 2
+      bool test_detection1() {
+
+        int size = simd::supportedSimdSize();
+
+        DEBUG("Found supported SIMD size: ", size, " bytes");
+
+        // The detected width is some power of two between a scalar double and an AVX-512 vector
+        bool passed = ( size >= (int)sizeof(double) ) && ( size <= 64 );
+
+        passed = passed && ( (size & (size - 1)) == 0 );
+
+        // The cached answer should be stable across calls
+        return passed && ( simd::supportedSimdSize() == size );
+
+      }
+
+
+      // Test 3
+      bool test_dispatch1() {
+
+        // The bound variant should match the detected width
+        int (*kernel)() = simd::dispatch(&__variant512, &__variant256, &__variantFallback);
+
+        int size = simd::supportedSimdSize();
+        int correct = size >= 64 ? 64 : ( size >= 32 ? 32 : 8 );
+
+        DEBUG("Bound the ", kernel(), " byte variant (correct ", correct, ")");
+
+        return kernel() == correct;
+
+      }
+
+
+    }
+
+  }
+
+}
+
+
+int main() {
+
+  quantpy::cpp::logging::verbosity(3);
+
+  quantpy::cpp::testing::TestSuite simdTests = quantpy::cpp::testing::TestSuite("simd.hpp");
+
+  simdTests.addTest(quantpy::cpp::simd_tests::test_widths1);
+  simdTests.addTest(quantpy::cpp::simd_tests::test_detection1);
+  simdTests.addTest(quantpy::cpp::simd_tests::test_dispatch1);
+
+  return (int)simdTests.runTests();
+
+}
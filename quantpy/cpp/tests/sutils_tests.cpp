@@ -169,6 +169,64 @@ namespace quantpy {
       }
 
 
+      // Test 9
+      bool test_forEachToken1() {
+
+        // The tokens should match those of 'split' and point into the original string
+        std::string testString = "|Hello||World|";
+
+        std::vector<std::string> correctTokens = {"Hello", "World"};
+        std::vector<std::string_view> foundTokens;
+
+        sutils::forEachToken(std::string_view(testString), '|', [&](std::string_view token) {
+          foundTokens.push_back(token);
+        });
+
+        bool passed = ( correctTokens.size() == foundTokens.size() );
+
+        for (int i = 0; i < (int)foundTokens.size(); i++) {
+          DEBUG("Found token: ", foundTokens[i]);
+          passed = passed && ( correctTokens[i] == foundTokens[i] );
+          passed = passed && ( foundTokens[i].data() >= testString.data() );
+          passed = passed && ( foundTokens[i].data() < testString.data() + testString.size() );
+        }
+
+        return passed;
+
+      }
+
+
+      // Test 10
+      bool test_splitView1() {
+
+        std::string testString = "   Hello   World";
+
+        std::string_view foundTokens[4];
+        int foundNum = sutils::splitView(std::string_view(testString), foundTokens, 4);
+
+        DEBUG("Found number of tokens: ", foundNum);
+
+        return ( foundNum == 2 ) && ( foundTokens[0] == "Hello" ) && ( foundTokens[1] == "World" );
+
+      }
+
+
+      // Test 11
+      bool test_splitView2() {
+
+        std::string testString = "2026-08-29,100,4.2";
+
+        std::string_view foundTokens[3];
+        int foundNum = sutils::splitView(std::string_view(testString), foundTokens, 3, ',');
+
+        DEBUG("Found number of tokens: ", foundNum);
+
+        return ( foundNum == 3 ) && ( foundTokens[0] == "2026-08-29" ) &&
+               ( foundTokens[1] == "100" ) && ( foundTokens[2] == "4.2" );
+
+      }
+
+
     }
     
   } 
@@ -190,6 +248,9 @@ int main() {
   sutilTests.addTest(quantpy::cpp::sutils_tests::test_toUpper);
   sutilTests.addTest(quantpy::cpp::sutils_tests::test_trim1);
   sutilTests.addTest(quantpy::cpp::sutils_tests::test_trim2);
+  sutilTests.addTest(quantpy::cpp::sutils_tests::test_forEachToken1);
+  sutilTests.addTest(quantpy::cpp::sutils_tests::test_splitView1);
+  sutilTests.addTest(quantpy::cpp::sutils_tests::test_splitView2);
 
   return (int)sutilTests.runTests();
 
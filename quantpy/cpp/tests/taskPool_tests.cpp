@@ -0,0 +1,155 @@
+/**
+ * @file taskPool_tests.cpp
+ * @brief Definition of tests for the work-stealing task pool
+ * @details Compile in the main quantpy directory with:
+ * > g++ -std=c++17 -mavx -fopenmp -Wall quantpy/cpp/tests/taskPool_tests.cpp -lm -o taskPool_tests.o
+ * Run with:
+ * > ./taskPool_tests.o
+ * @author Kasper Rantamäki
+ * @date 2026-08-29
+ */
+
+
+#include <cmath>
+#include <future>
+#include <vector>
+
+#include "../taskPool.hpp"
+#include "../testing.hpp"
+#include "../logging.hpp"
+
+
+namespace quantpy {
+
+  namespace cpp {
+
+    namespace taskPool_tests {
+
+
+      // Test 1
+      bool test_submit1() {
+
+        taskPool::TaskPool pool(4);
+
+        std::vector<std::future<int>> futures;
+
+        for (int i = 0; i < 100; i++) {
+          futures.push_back(pool.submit([i]() { return i * i; }));
+        }
+
+        bool passed = true;
+
+        for (int i = 0; i < 100; i++) {
+          passed = passed && ( pool.wait(futures[i]) == i * i );
+        }
+
+        return passed;
+
+      }
+
+
+      // Test 2
+      bool test_heterogeneous1() {
+
+        taskPool::TaskPool pool(4);
+
+        std::vector<std::future<double>> futures;
+
+        // Mix a few heavy jobs in with many trivial ones
+        for (int i = 0; i < 50; i++) {
+
+          if ( i % 10 == 0 ) {
+            futures.push_back(pool.submit([]() {
+              double sum = 0.;
+              for (int j = 1; j <= 1000000; j++) {
+                sum += 1. / ((double)j * (double)j);
+              }
+              return sum;
+            }));
+          }
+          else {
+            futures.push_back(pool.submit([i]() { return (double)i; }));
+          }
+
+        }
+
+        bool passed = true;
+
+        for (int i = 0; i < 50; i++) {
+
+          double found = pool.wait(futures[i]);
+
+          if ( i % 10 == 0 ) {
+            // The heavy jobs approximate pi^2 / 6
+            passed = passed && ( fabs(found - 1.6449340668) < 1e-5 );
+          }
+          else {
+            passed = passed && ( found == (double)i );
+          }
+
+        }
+
+        return passed;
+
+      }
+
+
+      // Test 3
+      bool test_nested1() {
+
+        taskPool::TaskPool pool(4);
+
+        // Each outer task splits into subtasks and waits on them from within the pool
+        std::vector<std::future<int>> futures;
+
+        for (int i = 0; i < 10; i++) {
+          futures.push_back(pool.submit([&pool, i]() {
+
+            std::vector<std::future<int>> subFutures;
+
+            for (int j = 0; j < 10; j++) {
+              subFutures.push_back(pool.submit([i, j]() { return i * j; }));
+            }
+
+            int sum = 0;
+
+            for (int j = 0; j < 10; j++) {
+              sum += pool.wait(subFutures[j]);
+            }
+
+            return sum;
+
+          }));
+        }
+
+        bool passed = true;
+
+        for (int i = 0; i < 10; i++) {
+          passed = passed && ( pool.wait(futures[i]) == i * 45 );
+        }
+
+        return passed;
+
+      }
+
+
+    }
+
+  }
+
+}
+
+
+int main() {
+
+  quantpy::cpp::logging::verbosity(3);
+
+  quantpy::cpp::testing::TestSuite taskPoolTests = quantpy::cpp::testing::TestSuite("taskPool.hpp");
+
+  taskPoolTests.addTest(quantpy::cpp::taskPool_tests::test_submit1);
+  taskPoolTests.addTest(quantpy::cpp::taskPool_tests::test_heterogeneous1);
+  taskPoolTests.addTest(quantpy::cpp::taskPool_tests::test_nested1);
+
+  return (int)taskPoolTests.runTests();
+
+}
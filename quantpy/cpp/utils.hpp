@@ -66,14 +66,20 @@ namespace quantpy {
        */
       inline int numTokens(const std::string& str, char delim = ' ') {
 
-        std::istringstream stream(str);
-        std::string token;
+        // Counted with a plain scan over the characters so no intermediate strings are allocated
         int count = 0;
+        bool inToken = false;
 
-        while (std::getline(stream, token, delim)) {
-          if (token != "") {
+        for (int i = 0; i < (int)str.size(); i++) {
+
+          if ( str[i] == delim ) {
+            inToken = false;
+          }
+          else if ( !inToken ) {
+            inToken = true;
             count++;
           }
+
         }
 
         return count;
@@ -89,7 +95,7 @@ namespace quantpy {
        * @returns         The keys in a std::vector
        */ 
       template<typename keyType, typename valType>
-      std::vector<keyType> mapKeys(std::map<keyType, valType> map) {
+      std::vector<keyType> mapKeys(const std::map<keyType, valType>& map) {
 
         std::vector<keyType> ret;
         for (const auto& [key, val] : map) {
@@ -109,7 +115,7 @@ namespace quantpy {
        * @returns         The values in a std::vector
        */ 
       template<typename keyType, typename valType>
-      std::vector<valType> mapVals(std::map<keyType, valType> map) {
+      std::vector<valType> mapVals(const std::map<keyType, valType>& map) {
 
         std::vector<valType> ret;
         for (const auto& [key, val] : map) {
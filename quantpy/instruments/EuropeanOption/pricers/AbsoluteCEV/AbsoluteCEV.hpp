@@ -129,7 +129,7 @@ namespace quantpy {
           return Vt - __AbsoluteCEVPrice(St, tau, r, K, vol, isCall);
         };
 
-        return quantpy::math::optimization::rootFinding::bisectionMethod<T>(targetFunc, lowerBound, upperBound);
+        return quantpy::math::optimization::rootFinding::brentMethod<T>(targetFunc, lowerBound, upperBound);
 
       }
 
@@ -214,6 +214,31 @@ namespace quantpy {
           }
 
 
+          /**
+           * @brief The batch pricing method
+           * @details Prices the whole batch in a single loop over the pricing kernel avoiding
+           * the per-option virtual dispatch of the base class implementation
+           * @param St   Pointer to an array of prices of the underlying
+           * @param tau  Pointer to an array of times to maturity in years
+           * @param out  Pointer to a caller-provided buffer into which the prices are written
+           * @param n    The number of options in the batch
+           * @param r    Pointer to an array of risk-free rates. Optional and defaults to nullptr
+           * @param vol  Pointer to an array of volatilities. Optional and defaults to nullptr
+           * @returns    Void. The prices are written into the 'out' buffer
+           */
+          void priceBatch(const T* St, const T* tau, T* out, int n, const T* r = nullptr, const T* vol = nullptr) const override {
+
+            if ( n < 0 ) {
+              ERROR("The number of options can not be negative! (", n, " < 0)");
+            }
+
+            for (int i = 0; i < n; i++) {
+              out[i] = __AbsoluteCEVPrice<T>(St[i], tau[i], r != nullptr ? r[i] : this->_r, this->_K, vol != nullptr ? vol[i] : this->_vol, this->_isCall);
+            }
+
+          }
+
+
           /**
            * @brief Method for calculating the implied volatility. Doesn't overwrite the existing volatility value
            * @param Vt          The market price of the option
@@ -10,6 +10,8 @@
 
 
 #include "../../../math/special/differentiation.hpp"
+#include "../../../cpp/evalCache.hpp"
+#include "../../../cpp/logging.hpp"
 
 
 namespace quantpy {
@@ -19,6 +21,23 @@ namespace quantpy {
     namespace EuropeanOption {
 
 
+      /**
+       * @brief Simple aggregate holding the price of an option together with all of its Greeks
+       * @tparam T  The template type. Should be some floating point number type
+       */
+      template <typename T>
+      struct Greeks {
+
+        T price;  /**< The price of the option */
+        T delta;  /**< The delta of the option */
+        T gamma;  /**< The gamma of the option */
+        T vega;   /**< The vega of the option */
+        T rho;    /**< The rho of the option */
+        T theta;  /**< The theta of the option */
+
+      };
+
+
       template<typename T>
       class BaseEuropeanOptionPricer {
 
@@ -29,6 +48,43 @@ namespace quantpy {
           T _K;          /**< The strike price */
           bool _isCall;  /**< Boolean flag telling the option type */
 
+          bool _useCache = false;                                        /**< Boolean flag telling if the evaluation cache is consulted */
+          mutable quantpy::cpp::evalCache::EvalCache<T, 4> _evalCache;   /**< The memoization cache over the (St, tau, r, vol) evaluations */
+
+
+          /**
+           * @brief Prices the option through the evaluation cache
+           * @details With the cache disabled this is a plain call to the pricing method. With the
+           * cache enabled the (St, tau, r, vol) point is first looked up from the cache, so e.g.
+           * overlapping finite difference stencil points and root-finding loops revisiting nearby
+           * arguments reprice only once
+           * @param St   The price of the underlying
+           * @param tau  The time to maturity in years
+           * @param r    The (continuously compounding) risk-free rate. Optional and defaults
+           * to the one used to initialize the object
+           * @param vol  The volatility. Optional and defaults to the one used to initialize the object
+           * @returns    The price of the option
+           */
+          T _cachedPrice(T St, T tau, T r = (T)-1., T vol = (T)-1.) const {
+
+            if ( !this->_useCache ) {
+              return this->operator() (St, tau, r, vol);
+            }
+
+            T args[4] = {St, tau, r != (T)-1. ? r : this->_r, vol != (T)-1. ? vol : this->_vol};
+            T value;
+
+            if ( this->_evalCache.lookup(args, value) ) {
+              return value;
+            }
+
+            value = this->operator() (St, tau, r, vol);
+            this->_evalCache.insert(args, value);
+
+            return value;
+
+          }
+
         public:
 
           /**
@@ -47,11 +103,39 @@ namespace quantpy {
           };
 
 
+          /**
+           * @brief Virtual function for pricing a batch of options over contiguous arrays
+           * @details The default implementation loops over the scalar pricing method, paying one virtual
+           * dispatch per element. Derived pricers should override this with a tight loop over their own
+           * pricing kernel so that the compiler can vectorize over the batch
+           * @param St   Pointer to an array of prices of the underlying
+           * @param tau  Pointer to an array of times to maturity in years
+           * @param out  Pointer to a caller-provided buffer into which the prices are written
+           * @param n    The number of options in the batch
+           * @param r    Pointer to an array of (continuously compounding) risk-free rates. Optional and
+           * defaults to nullptr, in which case the rate used to initialize the object is used
+           * @param vol  Pointer to an array of volatilities. Optional and defaults to nullptr, in which
+           * case the volatility used to initialize the object is used
+           * @returns    Void. The prices are written into the 'out' buffer
+           */
+          virtual void priceBatch(const T* St, const T* tau, T* out, int n, const T* r = nullptr, const T* vol = nullptr) const {
+
+            if ( n < 0 ) {
+              ERROR("The number of options can not be negative! (", n, " < 0)");
+            }
+
+            for (int i = 0; i < n; i++) {
+              out[i] = this->operator() (St[i], tau[i], r != nullptr ? r[i] : (T)-1., vol != nullptr ? vol[i] : (T)-1.);
+            }
+
+          }
+
+
           /**
            * @brief Setter for the risk-free rate
            * @returns The risk-free rate
            */
-          virtual T& r() { return this->_r; }
+          virtual T& r() { this->_evalCache.clear(); return this->_r; }
           
 
           /**
@@ -65,7 +149,7 @@ namespace quantpy {
            * @brief Setter for the volatility
            * @returns The volatility
            */
-          T& vol() { return this->_vol; }
+          T& vol() { this->_evalCache.clear(); return this->_vol; }
           
 
           /**
@@ -79,7 +163,7 @@ namespace quantpy {
            * @brief Setter for the strike price
            * @returns The strike price
            */
-          T& strike() { return this->_K; }
+          T& strike() { this->_evalCache.clear(); return this->_K; }
           
 
           /**
@@ -93,14 +177,32 @@ namespace quantpy {
            * @brief Setter for the 'isCall' flag
            * @returns The 'isCall' flag
            */
-          T& isCall() { return this->_isCall; }
-          
+          bool& isCall() { this->_evalCache.clear(); return this->_isCall; }
+
 
           /**
            * @brief Getter for the 'isCall' flag
            * @returns The 'isCall' flag
            */
-          const T& isCall() const { return this->_isCall; }
+          const bool& isCall() const { return this->_isCall; }
+
+
+          /**
+           * @brief Setter for the evaluation cache flag
+           * @details The cache is optional and off by default, as for cheap closed form pricers the
+           * lookups cost more than the repricings they save. Enabling it pays off for expensive
+           * pricers, e.g. the series based CEV kernels inside finite difference stencils or
+           * calibration loops. Handing out the mutable reference empties the cache
+           * @returns The evaluation cache flag
+           */
+          bool& useCache() { this->_evalCache.clear(); return this->_useCache; }
+
+
+          /**
+           * @brief Getter for the evaluation cache flag
+           * @returns The evaluation cache flag
+           */
+          const bool& useCache() const { return this->_useCache; }
 
 
           /**
@@ -113,7 +215,7 @@ namespace quantpy {
           virtual const T delta(T St, T tau, T h = 1e-6) const {
 
             auto deltaFunc = [=, this](T S) {
-              return this->operator() (S, tau);
+              return this->_cachedPrice(S, tau);
             };
 
             return quantpy::math::special::differentiation::firstCentralDiff<T>(deltaFunc, St, h);
@@ -131,7 +233,7 @@ namespace quantpy {
           virtual const T gamma(T St, T tau, T h = 1e-6) const {
 
             auto gammaFunc = [=, this](T S) {
-              return this->operator() (S, tau);
+              return this->_cachedPrice(S, tau);
             };
 
             return quantpy::math::special::differentiation::secondCentralDiff<T>(gammaFunc, St, h);
@@ -149,7 +251,7 @@ namespace quantpy {
           virtual const T vega(T St, T tau, T h = 1e-6) const {
 
             auto vegaFunc = [=, this](T vol) {
-              return this->operator() (St, tau, this->r(), vol);
+              return this->_cachedPrice(St, tau, this->_r, vol);
             };
 
             return quantpy::math::special::differentiation::firstCentralDiff<T>(vegaFunc, this->_vol, h);
@@ -167,7 +269,7 @@ namespace quantpy {
           virtual const T rho(T St, T tau, T h = 1e-6) const {
 
             auto rhoFunc = [=, this](T r) {
-              return this->operator() (St, tau, r);
+              return this->_cachedPrice(St, tau, r);
             };
 
             return quantpy::math::special::differentiation::firstCentralDiff<T>(rhoFunc, this->_r, h);
@@ -185,13 +287,45 @@ namespace quantpy {
           virtual const T theta(T St, T tau, T h = 1e-6) const {
 
             auto thetaFunc = [=, this](T t) {
-              return this->operator() (St, t);
+              return this->_cachedPrice(St, t);
             };
 
             return quantpy::math::special::differentiation::firstCentralDiff<T>(thetaFunc, tau, h);
 
           }
 
+
+          /**
+           * @brief Virtual function for calculating the price and all of the Greeks in one pass
+           * @details The default implementation evaluates the finite difference stencils directly so
+           * that the repricings are shared across the Greeks: the base price is reused by the gamma
+           * stencil and the bumped underlying prices serve both delta and gamma. This totals nine
+           * repricings instead of the thirteen needed by calling the individual methods. Pricers with
+           * closed form solutions should override this with a fused evaluation over shared intermediates
+           * @param St   The price of the underlying
+           * @param tau  The time to maturity in years
+           * @param h    The finite difference step size. Defaults to 1e-6
+           * @returns    A Greeks object holding the price and all of the Greeks
+           */
+          virtual Greeks<T> evaluate(T St, T tau, T h = 1e-6) const {
+
+            Greeks<T> greeks;
+
+            T base  = this->_cachedPrice(St, tau);
+            T upS   = this->_cachedPrice(St + h, tau);
+            T downS = this->_cachedPrice(St - h, tau);
+
+            greeks.price = base;
+            greeks.delta = (upS - downS) / ((T)2. * h);
+            greeks.gamma = (upS - (T)2. * base + downS) / (h * h);
+            greeks.vega  = (this->_cachedPrice(St, tau, this->_r, this->_vol + h) - this->_cachedPrice(St, tau, this->_r, this->_vol - h)) / ((T)2. * h);
+            greeks.rho   = (this->_cachedPrice(St, tau, this->_r + h) - this->_cachedPrice(St, tau, this->_r - h)) / ((T)2. * h);
+            greeks.theta = (this->_cachedPrice(St, tau + h) - this->_cachedPrice(St, tau - h)) / ((T)2. * h);
+
+            return greeks;
+
+          }
+
       };
 
 
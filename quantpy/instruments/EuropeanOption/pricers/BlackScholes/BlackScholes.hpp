@@ -11,6 +11,7 @@
 
 #include <cmath>
 
+#include "../../../../cpp/simd.hpp"
 #include "../../../../math/probability/normal.hpp"
 #include "../../../../math/optimization/rootFinding.hpp"
 #include "../BaseEuropeanOptionPricer.hpp"
@@ -86,6 +87,11 @@ namespace quantpy {
 
       /**
        * @brief Black-Scholes implied volatility. To be called by 'BlackScholes' class
+       * @details Solved with the Newton-Raphson method using the analytical vega as the derivative
+       * and the Brenner-Subrahmanyam approximation as the initial guess, which typically converges
+       * in a handful of price evaluations. Should the iteration wander outside of the given bounds
+       * or stall without repricing the quote, e.g. on a deep out-of-the-money option where the vega
+       * vanishes, the bracketed Brent method is used as a safeguard
        * @tparam T          The template type. Should support cmath math operations
        * @param Vt          The market price of the option
        * @param St          The market price of the underlying
@@ -104,7 +110,28 @@ namespace quantpy {
           return Vt - __BlackScholesPrice(St, tau, r, K, vol, isCall);
         };
 
-        return quantpy::math::optimization::rootFinding::bisectionMethod<T>(targetFunc, lowerBound, upperBound);
+        // The derivative of the target function is the negative of the analytical vega
+        auto derivFunc = [=](T vol) {
+          return -St * quantpy::math::probability::normal::pdf<T>((T)0., (T)1., __BlackScholesDp(St, tau, r, K, vol)) * sqrt(tau);
+        };
+
+        // The Brenner-Subrahmanyam approximation gives a good starting point for at-the-money options
+        T guess = sqrt((T)2. * (T)M_PI / tau) * Vt / St;
+
+        if ( guess < lowerBound || guess > upperBound ) {
+          guess = (lowerBound + upperBound) / (T)2.;
+        }
+
+        T vol = quantpy::math::optimization::rootFinding::newtonRaphson<T>(targetFunc, derivFunc, guess);
+
+        // The Newton-Raphson iteration returns the current iterate when the derivative vanishes, so
+        // the result can be in bounds yet nowhere near repricing the quote. The residual check below
+        // is written in the negated form so that non-finite results also trip the safeguard
+        if ( !(vol >= lowerBound && vol <= upperBound) || !(fabs(targetFunc(vol)) <= (T)1e-6) ) {
+          return quantpy::math::optimization::rootFinding::brentMethod<T>(targetFunc, lowerBound, upperBound);
+        }
+
+        return vol;
 
       }
 
@@ -190,6 +217,185 @@ namespace quantpy {
           }
 
 
+          /**
+           * @brief The batch pricing method
+           * @details Prices the whole batch in a single loop over the pricing kernel avoiding
+           * the per-option virtual dispatch of the base class implementation
+           * @param St   Pointer to an array of prices of the underlying
+           * @param tau  Pointer to an array of times to maturity in years
+           * @param out  Pointer to a caller-provided buffer into which the prices are written
+           * @param n    The number of options in the batch
+           * @param r    Pointer to an array of risk-free rates. Optional and defaults to nullptr
+           * @param vol  Pointer to an array of volatilities. Optional and defaults to nullptr
+           * @returns    Void. The prices are written into the 'out' buffer
+           */
+          void priceBatch(const T* St, const T* tau, T* out, int n, const T* r = nullptr, const T* vol = nullptr) const override {
+
+            if ( n < 0 ) {
+              ERROR("The number of options can not be negative! (", n, " < 0)");
+            }
+
+            for (int i = 0; i < n; i++) {
+              out[i] = __BlackScholesPrice<T>(St[i], tau[i], r != nullptr ? r[i] : this->_r, this->_K, vol != nullptr ? vol[i] : this->_vol, this->_isCall);
+            }
+
+          }
+
+
+          /**
+           * @brief Calculates the option delta from the closed form solution
+           * @details Overrides the finite difference fallback of the base class with the analytical
+           * formula, which costs a single evaluation of \f$ d_+ \f$ instead of two full repricings
+           * @param St   The market price of the underlying
+           * @param tau  The time to maturity in years
+           * @param h    The finite difference step size. Not considered in the calculation
+           * @returns    The delta of the option
+           */
+          const T delta(T St, T tau, T h = 1e-6) const override {
+
+            T dp = __BlackScholesDp<T>(St, tau, this->_r, this->_K, this->_vol);
+
+            if ( this->_isCall ) {
+              return quantpy::math::probability::normal::cdf<T>((T)0., (T)1., dp);
+            }
+
+            return quantpy::math::probability::normal::cdf<T>((T)0., (T)1., dp) - (T)1.;
+
+          }
+
+
+          /**
+           * @brief Calculates the option gamma from the closed form solution
+           * @details Overrides the finite difference fallback of the base class with the analytical
+           * formula, which costs a single evaluation of \f$ d_+ \f$ instead of three full repricings
+           * @param St   The market price of the underlying
+           * @param tau  The time to maturity in years
+           * @param h    The finite difference step size. Not considered in the calculation
+           * @returns    The gamma of the option
+           */
+          const T gamma(T St, T tau, T h = 1e-6) const override {
+
+            T dp = __BlackScholesDp<T>(St, tau, this->_r, this->_K, this->_vol);
+
+            return quantpy::math::probability::normal::pdf<T>((T)0., (T)1., dp) / (St * this->_vol * sqrt(tau));
+
+          }
+
+
+          /**
+           * @brief Calculates the option vega from the closed form solution
+           * @details Overrides the finite difference fallback of the base class with the analytical
+           * formula, which costs a single evaluation of \f$ d_+ \f$ instead of two full repricings
+           * @param St   The market price of the underlying
+           * @param tau  The time to maturity in years
+           * @param h    The finite difference step size. Not considered in the calculation
+           * @returns    The vega of the option
+           */
+          const T vega(T St, T tau, T h = 1e-6) const override {
+
+            T dp = __BlackScholesDp<T>(St, tau, this->_r, this->_K, this->_vol);
+
+            return St * quantpy::math::probability::normal::pdf<T>((T)0., (T)1., dp) * sqrt(tau);
+
+          }
+
+
+          /**
+           * @brief Calculates the option rho from the closed form solution
+           * @details Overrides the finite difference fallback of the base class with the analytical
+           * formula, which costs a single evaluation of \f$ d_- \f$ instead of two full repricings
+           * @param St   The market price of the underlying
+           * @param tau  The time to maturity in years
+           * @param h    The finite difference step size. Not considered in the calculation
+           * @returns    The rho of the option
+           */
+          const T rho(T St, T tau, T h = 1e-6) const override {
+
+            T dm = __BlackScholesDm<T>(St, tau, this->_r, this->_K, this->_vol);
+
+            if ( this->_isCall ) {
+              return this->_K * tau * exp(-this->_r * tau) * quantpy::math::probability::normal::cdf<T>((T)0., (T)1., dm);
+            }
+
+            return -this->_K * tau * exp(-this->_r * tau) * quantpy::math::probability::normal::cdf<T>((T)0., (T)1., -dm);
+
+          }
+
+
+          /**
+           * @brief Calculates the option theta from the closed form solution
+           * @details Overrides the finite difference fallback of the base class with the analytical
+           * formula sharing one evaluation of \f$ d_+ \f$ and \f$ d_- \f$. Note that the value follows
+           * the convention of the base class, i.e. it is the derivative with respect to the time to
+           * maturity rather than the calendar time
+           * @param St   The market price of the underlying
+           * @param tau  The time to maturity in years
+           * @param h    The finite difference step size. Not considered in the calculation
+           * @returns    The theta of the option
+           */
+          const T theta(T St, T tau, T h = 1e-6) const override {
+
+            T dp = __BlackScholesDp<T>(St, tau, this->_r, this->_K, this->_vol);
+            T dm = dp - this->_vol * sqrt(tau);
+
+            T timeValue = St * quantpy::math::probability::normal::pdf<T>((T)0., (T)1., dp) * this->_vol / ((T)2. * sqrt(tau));
+
+            if ( this->_isCall ) {
+              return timeValue + this->_r * this->_K * exp(-this->_r * tau) * quantpy::math::probability::normal::cdf<T>((T)0., (T)1., dm);
+            }
+
+            return timeValue - this->_r * this->_K * exp(-this->_r * tau) * quantpy::math::probability::normal::cdf<T>((T)0., (T)1., -dm);
+
+          }
+
+
+          /**
+           * @brief Calculates the price and all of the Greeks in one fused pass
+           * @details Overrides the finite difference default of the base class with a single evaluation
+           * of the shared intermediates: \f$ d_+ \f$, \f$ d_- \f$, their normal cdf values, the standard
+           * normal density at \f$ d_+ \f$ and the discount factor are each computed once and reused by
+           * every output. Calling the individual closed form methods instead would recompute each of
+           * them up to five times
+           * @param St   The market price of the underlying
+           * @param tau  The time to maturity in years
+           * @param h    The finite difference step size. Not considered in the calculation
+           * @returns    A Greeks object holding the price and all of the Greeks
+           */
+          Greeks<T> evaluate(T St, T tau, T h = 1e-6) const override {
+
+            T sqrtTau  = sqrt(tau);
+            T dp       = __BlackScholesDp<T>(St, tau, this->_r, this->_K, this->_vol);
+            T dm       = dp - this->_vol * sqrtTau;
+            T cdfDp    = quantpy::math::probability::normal::cdf<T>((T)0., (T)1., dp);
+            T cdfDm    = quantpy::math::probability::normal::cdf<T>((T)0., (T)1., dm);
+            T pdfDp    = quantpy::math::probability::normal::pdf<T>((T)0., (T)1., dp);
+            T discount = exp(-this->_r * tau);
+
+            T timeValue = St * pdfDp * this->_vol / ((T)2. * sqrtTau);
+
+            Greeks<T> greeks;
+
+            greeks.gamma = pdfDp / (St * this->_vol * sqrtTau);
+            greeks.vega  = St * pdfDp * sqrtTau;
+
+            if ( this->_isCall ) {
+              greeks.price = cdfDp * St - cdfDm * this->_K * discount;
+              greeks.delta = cdfDp;
+              greeks.rho   = this->_K * tau * discount * cdfDm;
+              greeks.theta = timeValue + this->_r * this->_K * discount * cdfDm;
+            }
+            else {
+              greeks.price = ((T)1. - cdfDm) * this->_K * discount - ((T)1. - cdfDp) * St;
+              greeks.delta = cdfDp - (T)1.;
+              greeks.rho   = -this->_K * tau * discount * ((T)1. - cdfDm);
+              greeks.theta = timeValue - this->_r * this->_K * discount * ((T)1. - cdfDm);
+            }
+
+            return greeks;
+
+          }
+
+
           /**
            * @brief Method for calculating the implied volatility. Doesn't overwrite the existing volatility value
            * @param Vt          The market price of the option
@@ -205,6 +411,137 @@ namespace quantpy {
 
           }
 
+
+          /**
+           * @brief Solves the implied volatilities for a whole strip of strikes at once
+           * @details Intended for inverting full option chains sharing the underlying and the expiry.
+           * The strikes are processed in SIMD blocks: the Newton iteration runs over all of the lanes
+           * simultaneously with the discount factor, sqrt(tau) and the log moneyness terms computed
+           * once per strip, and each iteration only steps the lanes that have not yet converged. The
+           * stepped volatilities are clamped into the given bounds, and any lane whose result fails
+           * to reprice its quote within the tolerance falls back on the safeguarded scalar method,
+           * as do the strikes left over from the last full block. Note that the strike stored on the
+           * pricer is not considered
+           * @param Vt          Pointer to an array of market prices of the options
+           * @param K           Pointer to an array of strike prices
+           * @param St          The market price of the underlying
+           * @param tau         The time to maturity in years
+           * @param out         Pointer to a caller-provided buffer into which the implied volatilities are written
+           * @param n           The number of strikes in the strip
+           * @param atol        The absolute tolerance on the price error at which a lane is considered converged. Defaults to 1e-6
+           * @param maxIter     The maximum number of Newton iterations per block. Defaults to 100
+           * @param lowerBound  The lower bound for the volatility. Defaults to 1e-6
+           * @param upperBound  The upper bound for the volatility. Defaults to 10
+           * @returns           Void. The implied volatilities are written into the 'out' buffer
+           */
+          void impliedVolSurface(const T* Vt, const T* K, T St, T tau, T* out, int n, T atol = (T)1e-6, int maxIter = 100,
+                                 T lowerBound = (T)1e-6, T upperBound = (T)10.) const {
+
+            if ( n < 0 ) {
+              ERROR("The number of strikes can not be negative! (", n, " < 0)");
+            }
+
+            typedef typename quantpy::cpp::simd::simd<T>::data simd_t;
+            constexpr int nLanes = SIMD_SIZE / (int)sizeof(T);
+
+            T sqrtTau    = sqrt(tau);
+            T discount   = exp(-this->_r * tau);
+            T guessScale = sqrt((T)2. * (T)M_PI / tau) / St;
+
+            int nBlocks = n / nLanes;
+
+            for (int block = 0; block < nBlocks; block++) {
+
+              const T* VtBlock = Vt + block * nLanes;
+              const T* KBlock  = K + block * nLanes;
+
+              simd_t marketPrice, strike, logMoneyness, vol;
+
+              for (int lane = 0; lane < nLanes; lane++) {
+                marketPrice[lane]  = VtBlock[lane];
+                strike[lane]       = KBlock[lane];
+                logMoneyness[lane] = log(St / KBlock[lane]);
+                // The Brenner-Subrahmanyam approximation gives the starting point for each lane
+                vol[lane]          = guessScale * VtBlock[lane];
+              }
+
+              for (int iter = 0; iter < maxIter; iter++) {
+
+                simd_t dp = (logMoneyness + (this->_r + vol * vol / (T)2.) * tau) / (vol * sqrtTau);
+                simd_t dm = dp - vol * sqrtTau;
+
+                simd_t cdfDp = quantpy::math::probability::normal::cdf<T>((T)0., (T)1., dp);
+                simd_t pdfDp = quantpy::math::probability::normal::pdf<T>((T)0., (T)1., dp);
+                simd_t cdfDm = quantpy::math::probability::normal::cdf<T>((T)0., (T)1., dm);
+
+                simd_t modelPrice;
+
+                if ( this->_isCall ) {
+                  modelPrice = cdfDp * St - cdfDm * strike * discount;
+                }
+                else {
+                  modelPrice = ((T)1. - cdfDm) * strike * discount - ((T)1. - cdfDp) * St;
+                }
+
+                simd_t diff = modelPrice - marketPrice;
+                simd_t vega = St * pdfDp * sqrtTau;
+
+                // Only the lanes that have not yet converged take a Newton step
+                bool allConverged = true;
+
+                for (int lane = 0; lane < nLanes; lane++) {
+                  if ( fabs(diff[lane]) > atol ) {
+
+                    vol[lane] -= diff[lane] / vega[lane];
+
+                    // Clamping the step into the bounds keeps a low-vega lane from jumping to a
+                    // volatility where the vega underflows to zero and the next step divides by it.
+                    // The comparisons are written in the negated form so a non-finite lane is also
+                    // pulled back into the bounds
+                    if ( !(vol[lane] >= lowerBound) ) {
+                      vol[lane] = lowerBound;
+                    }
+                    else if ( !(vol[lane] <= upperBound) ) {
+                      vol[lane] = upperBound;
+                    }
+
+                    allConverged = false;
+
+                  }
+                }
+
+                if ( allConverged ) {
+                  break;
+                }
+
+              }
+
+              for (int lane = 0; lane < nLanes; lane++) {
+
+                // A lane can exhaust the iterations pinned against a bound, e.g. on a deep
+                // out-of-the-money strike where the Newton steps make no progress. Any lane whose
+                // result fails to reprice its quote within the tolerance is re-solved with the
+                // safeguarded scalar method
+                T residual = fabs(VtBlock[lane] - __BlackScholesPrice<T>(St, tau, this->_r, KBlock[lane], vol[lane], this->_isCall));
+
+                if ( !(residual <= atol) ) {
+                  out[block * nLanes + lane] = __BlackScholesImpliedVol<T>(VtBlock[lane], St, tau, this->_r, KBlock[lane], this->_isCall, lowerBound, upperBound);
+                }
+                else {
+                  out[block * nLanes + lane] = vol[lane];
+                }
+
+              }
+
+            }
+
+            // The strikes left over from the last full block are solved with the scalar method
+            for (int i = nBlocks * nLanes; i < n; i++) {
+              out[i] = __BlackScholesImpliedVol<T>(Vt[i], St, tau, this->_r, K[i], this->_isCall, lowerBound, upperBound);
+            }
+
+          }
+
       };
 
 
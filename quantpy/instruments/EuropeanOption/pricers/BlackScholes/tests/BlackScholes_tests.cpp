@@ -238,6 +238,145 @@ namespace quantpy {
         }
 
 
+        // Test 15
+        bool test_priceBatch1() {
+
+          BlackScholes pricer = BlackScholes<double>(0.04, 120., 0.2, true);
+
+          double St[3]  = {95., 105., 115.};
+          double tau[3] = {0.5, 1.5, 2.5};
+          double out[3];
+
+          pricer.priceBatch(St, tau, out, 3);
+
+          bool passed = true;
+          for (int i = 0; i < 3; i++) {
+            DEBUG("Found price: ", out[i]);
+            passed = passed && ( fabs(pricer(St[i], tau[i]) - out[i]) < TEST_TOL );
+          }
+
+          return passed;
+
+        }
+
+
+        // Test 16
+        bool test_priceBatch2() {
+
+          BlackScholes pricer = BlackScholes<double>(0.05, 115., 0.15, false);
+
+          double St[3]  = {110., 120., 130.};
+          double tau[3] = {1.5, 1.5, 1.5};
+          double r[3]   = {0.03, 0.04, 0.05};
+          double vol[3] = {0.1, 0.15, 0.2};
+          double out[3];
+
+          pricer.priceBatch(St, tau, out, 3, r, vol);
+
+          bool passed = true;
+          for (int i = 0; i < 3; i++) {
+            DEBUG("Found price: ", out[i]);
+            passed = passed && ( fabs(pricer(St[i], tau[i], r[i], vol[i]) - out[i]) < TEST_TOL );
+          }
+
+          return passed;
+
+        }
+
+
+        // Test 17
+        bool test_evaluate1() {
+
+          BlackScholes pricer = BlackScholes<double>(0.04, 120., 0.2, true);
+
+          auto greeks = pricer.evaluate(105., 1.5);
+
+          bool passed = true;
+          passed = passed && ( fabs(greeks.price - pricer(105., 1.5)) < TEST_TOL );
+          passed = passed && ( fabs(greeks.delta - pricer.delta(105., 1.5)) < TEST_TOL );
+          passed = passed && ( fabs(greeks.gamma - pricer.gamma(105., 1.5)) < TEST_TOL );
+          passed = passed && ( fabs(greeks.vega - pricer.vega(105., 1.5)) < TEST_TOL );
+          passed = passed && ( fabs(greeks.rho - pricer.rho(105., 1.5)) < TEST_TOL );
+          passed = passed && ( fabs(greeks.theta - pricer.theta(105., 1.5)) < TEST_TOL );
+
+          return passed;
+
+        }
+
+
+        // Test 18
+        bool test_evaluate2() {
+
+          BlackScholes pricer = BlackScholes<double>(0.04, 120., 0.2, false);
+
+          auto greeks = pricer.evaluate(105., 1.5);
+
+          bool passed = true;
+          passed = passed && ( fabs(greeks.price - pricer(105., 1.5)) < TEST_TOL );
+          passed = passed && ( fabs(greeks.delta - pricer.delta(105., 1.5)) < TEST_TOL );
+          passed = passed && ( fabs(greeks.gamma - pricer.gamma(105., 1.5)) < TEST_TOL );
+          passed = passed && ( fabs(greeks.vega - pricer.vega(105., 1.5)) < TEST_TOL );
+          passed = passed && ( fabs(greeks.rho - pricer.rho(105., 1.5)) < TEST_TOL );
+          passed = passed && ( fabs(greeks.theta - pricer.theta(105., 1.5)) < TEST_TOL );
+
+          return passed;
+
+        }
+
+
+        // Test 19
+        bool test_impliedVolSurface1() {
+
+          BlackScholes pricer = BlackScholes<double>(0.04, 120., 0.2, true);
+
+          double K[10]  = {80., 90., 95., 100., 105., 110., 115., 120., 125., 130.};
+          double Vt[10];
+          double out[10];
+
+          // Generate the market prices from a known volatility and invert them back
+          for (int i = 0; i < 10; i++) {
+            Vt[i] = __BlackScholesPrice<double>(105., 1.5, 0.04, K[i], 0.2, true);
+          }
+
+          pricer.impliedVolSurface(Vt, K, 105., 1.5, out, 10);
+
+          bool passed = true;
+          for (int i = 0; i < 10; i++) {
+            DEBUG("Found implied volatility: ", out[i]);
+            passed = passed && ( fabs(out[i] - 0.2) < TEST_TOL );
+          }
+
+          return passed;
+
+        }
+
+
+        // Test 20
+        bool test_impliedVolSurface2() {
+
+          BlackScholes pricer = BlackScholes<double>(0.04, 120., 0.2, false);
+
+          double K[6]  = {90., 100., 110., 120., 130., 140.};
+          double Vt[6];
+          double out[6];
+
+          for (int i = 0; i < 6; i++) {
+            Vt[i] = __BlackScholesPrice<double>(105., 1.5, 0.04, K[i], 0.25, false);
+          }
+
+          pricer.impliedVolSurface(Vt, K, 105., 1.5, out, 6);
+
+          bool passed = true;
+          for (int i = 0; i < 6; i++) {
+            DEBUG("Found implied volatility: ", out[i]);
+            passed = passed && ( fabs(out[i] - 0.25) < TEST_TOL );
+          }
+
+          return passed;
+
+        }
+
+
       }
 
     }
@@ -267,6 +406,12 @@ int main() {
   BlackScholesTests.addTest(quantpy::instruments::EuropeanOption::BlackScholes_tests::test_theta2);
   BlackScholesTests.addTest(quantpy::instruments::EuropeanOption::BlackScholes_tests::test_impliedVol1);
   BlackScholesTests.addTest(quantpy::instruments::EuropeanOption::BlackScholes_tests::test_impliedVol2);
+  BlackScholesTests.addTest(quantpy::instruments::EuropeanOption::BlackScholes_tests::test_priceBatch1);
+  BlackScholesTests.addTest(quantpy::instruments::EuropeanOption::BlackScholes_tests::test_priceBatch2);
+  BlackScholesTests.addTest(quantpy::instruments::EuropeanOption::BlackScholes_tests::test_evaluate1);
+  BlackScholesTests.addTest(quantpy::instruments::EuropeanOption::BlackScholes_tests::test_evaluate2);
+  BlackScholesTests.addTest(quantpy::instruments::EuropeanOption::BlackScholes_tests::test_impliedVolSurface1);
+  BlackScholesTests.addTest(quantpy::instruments::EuropeanOption::BlackScholes_tests::test_impliedVolSurface2);
 
   return (int)BlackScholesTests.runTests();
 
@@ -12,12 +12,19 @@
 #include <cmath>
 #include <vector>
 #include <functional>
+#include <algorithm>
 #include <omp.h>
 
+#include "../../../../cpp/utils.hpp"
+#include "../../../../cpp/profiling.hpp"
+#include "../../../../cpp/reduction.hpp"
 #include "../../../../math/probability/normal.hpp"
+#include "../../../../math/probability/halton.hpp"
 #include "../../../../math/optimization/rootFinding.hpp"
 #include "../../../../math/stochasticProcesses/GeometricBrownianMotion.hpp"
+#include "../../../../math/stochasticProcesses/BrownianBridge.hpp"
 #include "../BaseEuropeanOptionPricer.hpp"
+#include "../BlackScholes/BlackScholes.hpp"
 
 
 namespace quantpy {
@@ -27,6 +34,28 @@ namespace quantpy {
     namespace EuropeanOption {
 
 
+      /**
+       * @struct AdaptiveResult
+       * @brief Struct for holding the result of an adaptive Monte Carlo pricing call
+       * @tparam T  The template type. Should be some floating point number type
+       * @var AdaptiveResult::price          The Monte Carlo estimate of the price
+       * @var AdaptiveResult::standardError  The standard error of the estimate
+       * @var AdaptiveResult::lowerBound     The lower bound of the 95 % confidence interval
+       * @var AdaptiveResult::upperBound     The upper bound of the 95 % confidence interval
+       * @var AdaptiveResult::nTrials        The number of trials actually run
+       */
+      template <typename T>
+      struct AdaptiveResult {
+
+        T price;
+        T standardError;
+        T lowerBound;
+        T upperBound;
+        int nTrials;
+
+      };
+
+
       /**
        * @brief Simple pricer based on Monte Carlo simulation under the Black-Scholes assumptions
        * @tparam T  The template type. Should be some floating point number type
@@ -39,6 +68,271 @@ namespace quantpy {
           quantpy::math::stochasticProcesses::GeometricBrownianMotion<T> _process;  /**< The stochastic process used in the simulation */
           int _nSteps;                                                              /**< The number of steps used in the simulation */
           int _nTrials;                                                             /**< The number of trials used in the simulation */
+          bool _quasiRandom = false;                                                /**< Boolean flag telling if quasi-random draws are used */
+          bool _antithetic = false;                                                 /**< Boolean flag telling if antithetic variates are used */
+          bool _controlVariate = false;                                             /**< Boolean flag telling if a control variate is used */
+          mutable T _standardError = (T)0.;                                         /**< The standard error of the most recent variance-reduced pricing call */
+
+          static constexpr int TERMINAL_BLOCK_SIZE = 1024;  /**< The number of terminal values drawn per block */
+
+
+          /**
+           * @brief Prices the option by drawing terminal values in blocks
+           * @details Fast path for the path-independent single step case. Each thread reuses one
+           * block buffer of terminal values, so the trial loop does no allocations and the
+           * lognormal transform vectorizes over the block
+           * @param St   The market price of the underlying
+           * @param tau  The time to maturity in years
+           * @returns    The price of the option
+           */
+          T _priceTerminal(T St, T tau) const {
+
+            PROFILE_FUNCTION()
+
+            int nBlocks = quantpy::cpp::utils::ceil(this->_nTrials, TERMINAL_BLOCK_SIZE);
+
+            // Total payoff accumulated over all of the simulations
+            T payoffSum = quantpy::cpp::reduction::parallelSum<T>(nBlocks, [&](int i) {
+
+              // The block buffer is allocated once per thread and reused across the blocks
+              static thread_local std::vector<T> block(TERMINAL_BLOCK_SIZE);
+
+              int blockTrials = i == nBlocks - 1 ? this->_nTrials - i * TERMINAL_BLOCK_SIZE : TERMINAL_BLOCK_SIZE;
+
+              this->_process.sampleTerminal(St, tau, blockTrials, block.data());
+
+              // The payoff accumulated within a single block
+              T blockPayoffSum = (T)0.;
+
+              for (int j = 0; j < blockTrials; j++) {
+                if ( this->_isCall ) {
+                  blockPayoffSum += block[j] > this->_K ? block[j] - this->_K : (T)0.;
+                }
+                else {
+                  blockPayoffSum += block[j] < this->_K ? this->_K - block[j] : (T)0.;
+                }
+              }
+
+              return blockPayoffSum;
+
+            });
+
+            return payoffSum / (T)this->_nTrials * exp(-this->_process.rts(tau) * tau);
+
+          }
+
+
+          /**
+           * @brief Prices the option with quasi-random draws
+           * @details The trials read consecutive points of a Halton sequence, transform them into
+           * normal draws with the quantile function and run them through a Brownian bridge, so the
+           * well-distributed leading dimensions decide the coarse shape of each path. For smooth
+           * payoffs the low-discrepancy points typically reach a given accuracy in 10-50x fewer
+           * trials than pseudo-random sampling. As a point is computed directly from its trial
+           * index, the result is deterministic and independent of the number of threads
+           * @param St   The market price of the underlying
+           * @param tau  The time to maturity in years
+           * @returns    The price of the option
+           */
+          T _priceQuasi(T St, T tau) const {
+
+            PROFILE_FUNCTION()
+
+            quantpy::math::stochasticProcesses::SamplingPlan<T> plan = this->_process.plan(tau, this->_nSteps);
+
+            quantpy::math::probability::halton::HaltonSequence sequence(this->_nSteps);
+            quantpy::math::stochasticProcesses::BrownianBridge<T> bridge(this->_nSteps);
+
+            T payoffSum = quantpy::cpp::reduction::parallelSum<T>(this->_nTrials, [&](int i) {
+
+              // The draw and increment buffers are allocated once per thread and reused across the trials
+              static thread_local std::vector<T> draws;
+              static thread_local std::vector<T> increments;
+
+              draws.resize(this->_nSteps);
+              increments.resize(this->_nSteps);
+
+              sequence.point<T>((uint64_t)i, draws.data());
+
+              for (int j = 0; j < this->_nSteps; j++) {
+                draws[j] = quantpy::math::probability::normal::quantile<T>((T)0., (T)1., draws[j]);
+              }
+
+              bridge.transform(draws.data(), increments.data());
+
+              T finalValue = this->_process.terminalValue(St, plan, increments.data());
+
+              if ( this->_isCall ) {
+                return finalValue > this->_K ? finalValue - this->_K : (T)0.;
+              }
+
+              return finalValue < this->_K ? this->_K - finalValue : (T)0.;
+
+            });
+
+            return payoffSum / (T)this->_nTrials * exp(-this->_process.rts(tau) * tau);
+
+          }
+
+
+          /**
+           * @brief The payoff of the option for a given terminal value of the underlying
+           * @param finalValue  The terminal value of the underlying
+           * @returns           The payoff of the option
+           */
+          T _payoff(T finalValue) const {
+
+            if ( this->_isCall ) {
+              return finalValue > this->_K ? finalValue - this->_K : (T)0.;
+            }
+
+            return finalValue < this->_K ? this->_K - finalValue : (T)0.;
+
+          }
+
+
+          /**
+           * @brief Prices the option with the enabled variance reduction techniques and tracks the standard error
+           * @details With antithetic variates each drawn normal vector is reused negated and the pair
+           * average taken as one observation, halving the generator work while cancelling the odd
+           * payoff terms. The control variate is the payoff of a flat-curve proxy driven by the same
+           * draws, whose exact expectation is the analytic Black-Scholes price; the variance-optimal
+           * coefficient is estimated on the fly from the accumulated moments. The per-thread moment
+           * accumulation and fixed-order merge follow the shared reduction utility, so the estimate
+           * is deterministic for a given seed and thread count
+           * @param St   The market price of the underlying
+           * @param tau  The time to maturity in years
+           * @returns    The price of the option. The standard error is stored on the object
+           */
+          T _priceStats(T St, T tau) const {
+
+            PROFILE_FUNCTION()
+
+            quantpy::math::stochasticProcesses::SamplingPlan<T> plan = this->_process.plan(tau, this->_nSteps);
+
+            // One observation covers two trials when antithetic variates are enabled
+            int nObs = this->_antithetic ? this->_nTrials / 2 : this->_nTrials;
+
+            if ( nObs < 2 ) {
+              ERROR("Too few trials for the enabled variance reduction! (", this->_nTrials, ")");
+            }
+
+            // The flat-curve proxy driving the control variate. The dividend yield is folded into
+            // the spot so that the proxy expectation is an undividended Black-Scholes price
+            T r   = this->_process.rts((T)0.);
+            T q   = this->_process.qts((T)0.);
+            T vol = this->_process.volts((T)0.);
+
+            T controlDrift     = (r - q - vol * vol / (T)2.) * tau;
+            T controlDiffusion = vol * sqrt(tau / (T)this->_nSteps);
+
+            T discount = exp(-this->_process.rts(tau) * tau);
+
+            int maxThreads = omp_get_max_threads();
+
+            // Per-thread partial sums for the payoff and control moments. Written by the owning thread only
+            std::vector<T> payoffPartials(maxThreads, (T)0.);
+            std::vector<T> payoffSqPartials(maxThreads, (T)0.);
+            std::vector<T> controlPartials(maxThreads, (T)0.);
+            std::vector<T> controlSqPartials(maxThreads, (T)0.);
+            std::vector<T> crossPartials(maxThreads, (T)0.);
+
+            #pragma omp parallel
+            {
+              T payoffSum = (T)0., payoffSqSum = (T)0.;
+              T controlSum = (T)0., controlSqSum = (T)0., crossSum = (T)0.;
+
+              // The scratch buffer is allocated once per thread and reused across the trials
+              std::vector<T> scratch(this->_nSteps);
+
+              static thread_local quantpy::math::probability::normal::NormalSampler<T> sampler{};
+
+              #pragma omp for schedule(static) nowait
+              for (int i = 0; i < nObs; i++) {
+
+                sampler.fill(scratch.data(), this->_nSteps);
+
+                T drawSum = (T)0.;
+                for (int j = 0; j < this->_nSteps; j++) {
+                  drawSum += scratch[j];
+                }
+
+                T payoff  = this->_payoff(this->_process.terminalValue(St, plan, scratch.data()));
+                T control = this->_payoff(St * exp(controlDrift + controlDiffusion * drawSum));
+
+                if ( this->_antithetic ) {
+
+                  // Reuse the drawn vector negated and average the pair into one observation
+                  for (int j = 0; j < this->_nSteps; j++) {
+                    scratch[j] = -scratch[j];
+                  }
+
+                  payoff  = (payoff + this->_payoff(this->_process.terminalValue(St, plan, scratch.data()))) / (T)2.;
+                  control = (control + this->_payoff(St * exp(controlDrift - controlDiffusion * drawSum))) / (T)2.;
+
+                }
+
+                payoffSum    += payoff;
+                payoffSqSum  += payoff * payoff;
+                controlSum   += control;
+                controlSqSum += control * control;
+                crossSum     += payoff * control;
+
+              }
+
+              int thread = omp_get_thread_num();
+
+              payoffPartials[thread]    = payoffSum;
+              payoffSqPartials[thread]  = payoffSqSum;
+              controlPartials[thread]   = controlSum;
+              controlSqPartials[thread] = controlSqSum;
+              crossPartials[thread]     = crossSum;
+            }
+
+            // Combine the partials with a fixed-order pairwise tree reduction
+            for (int stride = 1; stride < maxThreads; stride *= 2) {
+              for (int i = 0; i + stride < maxThreads; i += 2 * stride) {
+                payoffPartials[i]    += payoffPartials[i + stride];
+                payoffSqPartials[i]  += payoffSqPartials[i + stride];
+                controlPartials[i]   += controlPartials[i + stride];
+                controlSqPartials[i] += controlSqPartials[i + stride];
+                crossPartials[i]     += crossPartials[i + stride];
+              }
+            }
+
+            T payoffMean  = payoffPartials[0] / (T)nObs;
+            T controlMean = controlPartials[0] / (T)nObs;
+
+            T payoffVar  = (payoffSqPartials[0] - (T)nObs * payoffMean * payoffMean) / (T)(nObs - 1);
+            T controlVar = (controlSqPartials[0] - (T)nObs * controlMean * controlMean) / (T)(nObs - 1);
+            T covariance = (crossPartials[0] - (T)nObs * payoffMean * controlMean) / (T)(nObs - 1);
+
+            T estimate = payoffMean;
+            T variance = payoffVar;
+
+            if ( this->_controlVariate ) {
+
+              T beta = controlVar > (T)0. ? covariance / controlVar : (T)0.;
+
+              // The exact expectation of the undiscounted control payoff: the closed form price of
+              // the flat-curve proxy compounded back at the proxy rate
+              T controlExpectation = __BlackScholesPrice<T>(St * exp(-q * tau), tau, r, this->_K, vol, this->_isCall) * exp(r * tau);
+
+              DEBUG("beta = ", beta, " | control mean = ", controlMean, " | control expectation = ", controlExpectation)
+
+              estimate = payoffMean - beta * (controlMean - controlExpectation);
+              variance = payoffVar - (T)2. * beta * covariance + beta * beta * controlVar;
+
+              // A perfectly correlated control can leave the residual slightly negative through rounding
+              variance = variance > (T)0. ? variance : (T)0.;
+
+            }
+
+            this->_standardError = discount * sqrt(variance / (T)nObs);
+
+            return discount * estimate;
+
+          }
 
         public:
 
@@ -55,10 +349,16 @@ namespace quantpy {
            * @param nTrials   The number of trials used in the simulation
            * @param nSteps    The number of steps used in the simulation. Needs to be a positive integer.
            * Defaults to 1 as European options are path independent.
-           * @param isCall    Boolean flag telling if the option is a call or a put. Defaults to 'true'
-           * @returns         The pricer object
+           * @param isCall       Boolean flag telling if the option is a call or a put. Defaults to 'true'
+           * @param quasiRandom  Boolean flag telling if quasi-random (Halton) draws are used instead of
+           * pseudo-random ones. Defaults to 'false'
+           * @param antithetic      Boolean flag telling if antithetic variates are used. Ignored in the
+           * quasi-random mode. Defaults to 'false'
+           * @param controlVariate  Boolean flag telling if the analytic Black-Scholes control variate is
+           * used. Ignored in the quasi-random mode. Defaults to 'false'
+           * @returns            The pricer object
            */
-          BlackScholesMonteCarlo(quantpy::math::stochasticProcesses::GeometricBrownianMotion<T> process, T K, int nTrials, int nSteps = 1, bool isCall = true) {
+          BlackScholesMonteCarlo(quantpy::math::stochasticProcesses::GeometricBrownianMotion<T> process, T K, int nTrials, int nSteps = 1, bool isCall = true, bool quasiRandom = false, bool antithetic = false, bool controlVariate = false) {
 
             if ( nSteps < 1 ) {
               ERROR("The number of samples must be be positive! (", nSteps, " < 1)");
@@ -73,6 +373,176 @@ namespace quantpy {
             this->_nSteps  = nSteps;
             this->_isCall  = isCall;
             this->_K = K;
+            this->_quasiRandom = quasiRandom;
+            this->_antithetic = antithetic;
+            this->_controlVariate = controlVariate;
+
+          }
+
+
+          /**
+           * @brief Setter for the quasi-random sampling flag
+           * @returns The quasi-random sampling flag
+           */
+          virtual bool& quasiRandom() { return this->_quasiRandom; }
+
+
+          /**
+           * @brief Getter for the quasi-random sampling flag
+           * @returns The quasi-random sampling flag
+           */
+          const bool& quasiRandom() const { return this->_quasiRandom; }
+
+
+          /**
+           * @brief Setter for the antithetic variates flag
+           * @returns The antithetic variates flag
+           */
+          virtual bool& antithetic() { return this->_antithetic; }
+
+
+          /**
+           * @brief Getter for the antithetic variates flag
+           * @returns The antithetic variates flag
+           */
+          const bool& antithetic() const { return this->_antithetic; }
+
+
+          /**
+           * @brief Setter for the control variate flag
+           * @returns The control variate flag
+           */
+          virtual bool& controlVariate() { return this->_controlVariate; }
+
+
+          /**
+           * @brief Getter for the control variate flag
+           * @returns The control variate flag
+           */
+          const bool& controlVariate() const { return this->_controlVariate; }
+
+
+          /**
+           * @brief Getter for the standard error of the most recent pricing call
+           * @details Only tracked when a variance reduction mode is enabled; otherwise zero
+           * @returns The standard error of the Monte Carlo estimate
+           */
+          const T& standardError() const { return this->_standardError; }
+
+
+          /**
+           * @brief Prices the option adaptively until a target standard error is reached
+           * @details The trials are run in batches with the running mean and variance tracked across
+           * them, stopping as soon as the standard error falls below the given tolerance or the trial
+           * cap is hit. Easy cases (e.g. deep in-the-money options) thus stop after a few batches
+           * while hard ones keep sampling, instead of every call paying for the worst case. The
+           * batches use the plain pseudo-random sampler, so the fixed '_nTrials' of the object is
+           * ignored in favor of the adaptive stopping rule
+           * @param St         The market price of the underlying
+           * @param tau        The time to maturity in years
+           * @param seTol      The standard error at which the sampling is stopped
+           * @param maxTrials  The cap on the number of trials. Defaults to 10000000
+           * @param batchSize  The number of trials run between the stopping checks. Defaults to 16384
+           * @returns          The price estimate with its standard error and 95 % confidence interval
+           */
+          AdaptiveResult<T> priceAdaptive(T St, T tau, T seTol, int maxTrials = 10000000, int batchSize = 16384) const {
+
+            PROFILE_FUNCTION()
+
+            if ( seTol <= (T)0. ) {
+              ERROR("The standard error tolerance must be positive! (", seTol, " <= 0)");
+            }
+
+            if ( batchSize < 2 || maxTrials < batchSize ) {
+              ERROR("Invalid batching! (", batchSize, " trials per batch, ", maxTrials, " at most)");
+            }
+
+            quantpy::math::stochasticProcesses::SamplingPlan<T> plan = this->_process.plan(tau, this->_nSteps);
+
+            T discount = exp(-this->_process.rts(tau) * tau);
+
+            int maxThreads = omp_get_max_threads();
+
+            // Per-thread partial sums for the payoff moments. Written by the owning thread only
+            std::vector<T> payoffPartials(maxThreads);
+            std::vector<T> payoffSqPartials(maxThreads);
+
+            // The running moments across the batches
+            T payoffSum   = (T)0.;
+            T payoffSqSum = (T)0.;
+            int nDone = 0;
+
+            T standardError = (T)0.;
+
+            while ( nDone < maxTrials ) {
+
+              int batch = maxTrials - nDone < batchSize ? maxTrials - nDone : batchSize;
+
+              std::fill(payoffPartials.begin(), payoffPartials.end(), (T)0.);
+              std::fill(payoffSqPartials.begin(), payoffSqPartials.end(), (T)0.);
+
+              #pragma omp parallel
+              {
+                T threadSum = (T)0., threadSqSum = (T)0.;
+
+                // The scratch buffer is allocated once per thread and reused across the trials
+                std::vector<T> scratch(this->_nSteps);
+
+                static thread_local quantpy::math::probability::normal::NormalSampler<T> sampler{};
+
+                #pragma omp for schedule(static) nowait
+                for (int i = 0; i < batch; i++) {
+                  sampler.fill(scratch.data(), this->_nSteps);
+                  T payoff = this->_payoff(this->_process.terminalValue(St, plan, scratch.data()));
+                  threadSum   += payoff;
+                  threadSqSum += payoff * payoff;
+                }
+
+                int thread = omp_get_thread_num();
+                payoffPartials[thread]   = threadSum;
+                payoffSqPartials[thread] = threadSqSum;
+              }
+
+              // Combine the partials with a fixed-order pairwise tree reduction
+              for (int stride = 1; stride < maxThreads; stride *= 2) {
+                for (int i = 0; i + stride < maxThreads; i += 2 * stride) {
+                  payoffPartials[i]   += payoffPartials[i + stride];
+                  payoffSqPartials[i] += payoffSqPartials[i + stride];
+                }
+              }
+
+              payoffSum   += payoffPartials[0];
+              payoffSqSum += payoffSqPartials[0];
+              nDone += batch;
+
+              T mean = payoffSum / (T)nDone;
+              T variance = (payoffSqSum - (T)nDone * mean * mean) / (T)(nDone - 1);
+
+              standardError = discount * sqrt(variance / (T)nDone);
+
+              DEBUG("Trials done: ", nDone, " | standard error: ", standardError)
+
+              if ( standardError <= seTol ) {
+                break;
+              }
+
+            }
+
+            if ( standardError > seTol ) {
+              WARNING("The trial cap was hit before the target standard error! (", standardError, " > ", seTol, ")");
+            }
+
+            AdaptiveResult<T> result;
+
+            result.price         = discount * payoffSum / (T)nDone;
+            result.standardError = standardError;
+            result.lowerBound    = result.price - (T)1.959964 * standardError;
+            result.upperBound    = result.price + (T)1.959964 * standardError;
+            result.nTrials       = nDone;
+
+            this->_standardError = standardError;
+
+            return result;
 
           }
 
@@ -87,34 +557,46 @@ namespace quantpy {
            */
           T operator() (T St, T tau, T r = (T)-1., T vol = (T)-1.) const override {
 
+            PROFILE_FUNCTION()
+
+            this->_standardError = (T)0.;
+
+            if ( this->_quasiRandom ) {
+              return this->_priceQuasi(St, tau);
+            }
+
+            if ( this->_antithetic || this->_controlVariate ) {
+              return this->_priceStats(St, tau);
+            }
+
+            // European options are path independent, so with a single step the terminal values can be
+            // drawn directly from the terminal law in blocks without materializing any paths
+            if ( this->_nSteps == 1 ) {
+              return this->_priceTerminal(St, tau);
+            }
+
+            // The per-step drift and diffusion terms are identical across the trials, so they are
+            // precomputed once and the per-trial sampling just reads the tables
+            quantpy::math::stochasticProcesses::SamplingPlan<T> plan = this->_process.plan(tau, this->_nSteps);
+
             // Total payoff accumulated over all of the simulations
-            T payoffSum = (T)0.;
+            T payoffSum = quantpy::cpp::reduction::parallelSum<T>(this->_nTrials, [&](int i) {
 
-            #pragma omp parallel 
-            {
-              // The payoff accumulated within a single thread
-              T threadPayoffSum = (T)0.;
-            
-              #pragma omp for nowait
-              for (int i = 0; i < this->_nTrials; i++) {
-                std::vector<T> path = this->_process.sample(St, tau, this->_nSteps);
+              // The scratch buffer is allocated once per thread and reused across the trials
+              static thread_local std::vector<T> scratch;
 
-                T finalValue = path[this->_nSteps];
+              scratch.resize(this->_nSteps);
 
-                if ( this->_isCall ) {
-                  threadPayoffSum += finalValue > this->_K ? finalValue - this->_K : (T)0.;
-                }
-                else {
-                  threadPayoffSum += finalValue < this->_K ? this->_K - finalValue : (T)0.;
-                }
-              }
+              // European options are path independent, so only the terminal value is materialized
+              T finalValue = this->_process.sampleTerminal(St, plan, scratch.data());
 
-              #pragma omp critical 
-              {
-                // Accumulate the total payoff sum without race conditions
-                payoffSum += threadPayoffSum;
+              if ( this->_isCall ) {
+                return finalValue > this->_K ? finalValue - this->_K : (T)0.;
               }
-            }
+
+              return finalValue < this->_K ? this->_K - finalValue : (T)0.;
+
+            });
 
             return payoffSum / (T)this->_nTrials * exp(-this->_process.rts(tau) * tau);
 
@@ -272,6 +272,85 @@ namespace quantpy {
         }
 
 
+        // Test 13
+        bool test_quasiRandom1() {
+
+          auto rts   = [](double tau) { return 0.04; };
+          auto qts   = [](double tau) { return 0.00; };
+          auto volts = [](double tau) { return 0.2; };
+
+          GeometricBrownianMotion process = GeometricBrownianMotion<double>(rts, qts, volts);
+          BlackScholesMonteCarlo pricer   = BlackScholesMonteCarlo<double>(process, 120., 50000, 16, true, true);
+
+          double correctPrice = 7.0922196;
+          double foundPrice   = pricer(105., 1.5);
+
+          DEBUG("Found price: ", foundPrice);
+
+          // The quasi-random pricer is deterministic, so repeated calls must agree exactly
+          return ( fabs(correctPrice - foundPrice) < TEST_TOL ) && ( foundPrice == pricer(105., 1.5) );
+
+        }
+
+
+        // Test 14
+        bool test_varianceReduction1() {
+
+          auto rts   = [](double tau) { return 0.04; };
+          auto qts   = [](double tau) { return 0.00; };
+          auto volts = [](double tau) { return 0.2; };
+
+          GeometricBrownianMotion process = GeometricBrownianMotion<double>(rts, qts, volts);
+          BlackScholesMonteCarlo antitheticPricer = BlackScholesMonteCarlo<double>(process, 120., 50000, 4, true, false, true, false);
+          BlackScholesMonteCarlo controlPricer    = BlackScholesMonteCarlo<double>(process, 120., 50000, 4, true, false, true, true);
+
+          double correctPrice = 7.0922196;
+
+          double antitheticPrice = antitheticPricer(105., 1.5);
+          double controlPrice    = controlPricer(105., 1.5);
+
+          DEBUG("Found prices: ", antitheticPrice, " and ", controlPrice, " with standard errors: ",
+                antitheticPricer.standardError(), " and ", controlPricer.standardError());
+
+          bool passed = ( fabs(correctPrice - antitheticPrice) < TEST_TOL );
+          passed = passed && ( fabs(correctPrice - controlPrice) < TEST_TOL );
+
+          // The antithetic estimate retains sampling noise while the control variate should all
+          // but eliminate it here, as the control coincides with the payoff under flat curves
+          passed = passed && ( antitheticPricer.standardError() > 0. );
+          passed = passed && ( controlPricer.standardError() < antitheticPricer.standardError() );
+
+          return passed;
+
+        }
+
+
+        // Test 15
+        bool test_priceAdaptive1() {
+
+          auto rts   = [](double tau) { return 0.04; };
+          auto qts   = [](double tau) { return 0.00; };
+          auto volts = [](double tau) { return 0.2; };
+
+          GeometricBrownianMotion process = GeometricBrownianMotion<double>(rts, qts, volts);
+          BlackScholesMonteCarlo pricer   = BlackScholesMonteCarlo<double>(process, 120., 50000, 4);
+
+          double correctPrice = 7.0922196;
+          AdaptiveResult<double> result = pricer.priceAdaptive(105., 1.5, 0.02);
+
+          DEBUG("Found price: ", result.price, " with standard error: ", result.standardError,
+                " after ", result.nTrials, " trials");
+
+          bool passed = ( fabs(correctPrice - result.price) < TEST_TOL );
+          passed = passed && ( result.standardError <= 0.02 );
+          passed = passed && ( result.lowerBound < result.price && result.price < result.upperBound );
+          passed = passed && ( result.nTrials <= 10000000 );
+
+          return passed;
+
+        }
+
+
       }
 
     }
@@ -299,6 +378,9 @@ int main() {
   BlackScholesMonteCarloTests.addTest(quantpy::instruments::EuropeanOption::BlackScholesMonteCarlo_tests::test_rho2);
   BlackScholesMonteCarloTests.addTest(quantpy::instruments::EuropeanOption::BlackScholesMonteCarlo_tests::test_theta1);
   BlackScholesMonteCarloTests.addTest(quantpy::instruments::EuropeanOption::BlackScholesMonteCarlo_tests::test_theta2);
+  BlackScholesMonteCarloTests.addTest(quantpy::instruments::EuropeanOption::BlackScholesMonteCarlo_tests::test_quasiRandom1);
+  BlackScholesMonteCarloTests.addTest(quantpy::instruments::EuropeanOption::BlackScholesMonteCarlo_tests::test_varianceReduction1);
+  BlackScholesMonteCarloTests.addTest(quantpy::instruments::EuropeanOption::BlackScholesMonteCarlo_tests::test_priceAdaptive1);
 
   return (int)BlackScholesMonteCarloTests.runTests();
 
@@ -0,0 +1,233 @@
+/**
+ * @file CarrMadan.hpp
+ * @brief FFT-based strike-grid pricer following the Carr-Madan method
+ * @details Carr and Madan [1] showed that for any model with a known characteristic function of the
+ * terminal log price, the Fourier transform of the exponentially damped call price can be written in
+ * closed form. A single fast Fourier transform then recovers the call prices on a whole grid of log
+ * strikes at once, so pricing a full option chain costs one \f$ O(N \log N) \f$ transform instead of
+ * hundreds of independent pricings that each repeat all of the underlying- and expiry-dependent
+ * work. The pricer implements the Black-Scholes characteristic function; models with other known
+ * characteristic functions (e.g. stochastic volatility) can derive from the class and override it.
+ * [1]: P. Carr and D. Madan, "Option valuation using the fast Fourier transform",
+ * Journal of Computational Finance, vol. 2, no. 4, pp. 61-73, 1999
+ * @author Kasper Rantamäki
+ * @date 2026-08-29
+ */
+
+#ifndef CARR_MADAN_HPP
+#define CARR_MADAN_HPP
+
+
+#include <cmath>
+#include <complex>
+#include <vector>
+
+#include "../../../../cpp/logging.hpp"
+#include "../../../../math/fourier/fft.hpp"
+#include "../BaseEuropeanOptionPricer.hpp"
+
+
+namespace quantpy {
+
+  namespace instruments {
+
+    namespace EuropeanOption {
+
+
+      /**
+       * @brief FFT-based strike-grid pricer following the Carr-Madan method
+       * @tparam T  The template type. Should be some floating point number type
+       */
+      template <typename T>
+      class CarrMadan : public BaseEuropeanOptionPricer<T> {
+
+        protected:
+
+          T _dampingFactor;  /**< The damping factor alpha keeping the transformed call price integrable */
+          int _nGridPoints;  /**< The number of grid points used in the transform */
+          T _gridSpacing;    /**< The spacing of the integration grid in the frequency domain */
+
+
+          /**
+           * @brief The characteristic function of the terminal log price
+           * @details Implements the Black-Scholes lognormal terminal law. Models with other known
+           * characteristic functions should override this method, which is the only model-dependent
+           * piece of the pricer
+           * @param u    The (complex) frequency at which the function is evaluated
+           * @param St   The market price of the underlying
+           * @param tau  The time to maturity in years
+           * @param r    The (continuously compounding) risk-free rate
+           * @param vol  The volatility
+           * @returns    The characteristic function evaluated at 'u'
+           */
+          virtual std::complex<T> _characteristicFunction(std::complex<T> u, T St, T tau, T r, T vol) const {
+
+            std::complex<T> i((T)0., (T)1.);
+
+            T drift = log(St) + (r - vol * vol / (T)2.) * tau;
+
+            return std::exp(i * u * drift - vol * vol * tau / (T)2. * u * u);
+
+          }
+
+        public:
+
+          /**
+           * @brief Default constructor
+           * @returns  Uninitialized CarrMadan object
+           */
+          CarrMadan() {  }
+
+
+          /**
+           * @brief Main constructor
+           * @param r              The (continuously compounding) risk-free rate
+           * @param K              The strike price used by the scalar pricing method
+           * @param vol            The volatility
+           * @param isCall         Boolean flag telling if the option is a call or a put. Defaults to 'true'
+           * @param dampingFactor  The damping factor alpha. Defaults to 1.5
+           * @param nGridPoints    The number of grid points used in the transform. Needs to be a power
+           * of two. Defaults to 4096
+           * @param gridSpacing    The spacing of the integration grid in the frequency domain. Defaults to 0.25
+           * @returns              The pricer object
+           */
+          CarrMadan(T r, T K, T vol, bool isCall = true, T dampingFactor = (T)1.5, int nGridPoints = 4096, T gridSpacing = (T)0.25) {
+
+            if ( dampingFactor <= (T)0. ) {
+              ERROR("The damping factor must be positive! (", dampingFactor, " <= 0)");
+            }
+
+            if ( nGridPoints < 2 || (nGridPoints & (nGridPoints - 1)) != 0 ) {
+              ERROR("The number of grid points needs to be a power of two! (", nGridPoints, ")");
+            }
+
+            if ( gridSpacing <= (T)0. ) {
+              ERROR("The grid spacing must be positive! (", gridSpacing, " <= 0)");
+            }
+
+            this->_r   = r;
+            this->_K   = K;
+            this->_vol = vol;
+            this->_isCall = isCall;
+
+            this->_dampingFactor = dampingFactor;
+            this->_nGridPoints   = nGridPoints;
+            this->_gridSpacing   = gridSpacing;
+
+          }
+
+
+          /**
+           * @brief Prices a whole chain of strikes with a single transform
+           * @details The damped call price transform is evaluated on the frequency grid with Simpson
+           * weights, run through one FFT and undamped, yielding the call prices on a log-strike grid
+           * centered at the spot. The requested strikes are then linearly interpolated in log strike
+           * and puts recovered through the put-call parity. The grid spans several orders of magnitude
+           * of moneyness, so any reasonable chain fits well inside it
+           * @param St       The market price of the underlying
+           * @param tau      The time to maturity in years
+           * @param K        Pointer to an array of strike prices
+           * @param out      Pointer to a caller-provided buffer into which the prices are written
+           * @param n        The number of strikes in the chain
+           * @param isCall   Boolean flag telling if the options are calls or puts. Defaults to 'true'
+           * @returns        Void. The prices are written into the 'out' buffer
+           */
+          void priceChain(T St, T tau, const T* K, T* out, int n, bool isCall = true) const {
+
+            if ( n < 0 ) {
+              ERROR("The number of strikes can not be negative! (", n, " < 0)");
+            }
+
+            int N = this->_nGridPoints;
+
+            T alpha  = this->_dampingFactor;
+            T eta    = this->_gridSpacing;
+            T lambda = (T)2. * (T)PI / ((T)N * eta);
+
+            T logSpot  = log(St);
+            T discount = exp(-this->_r * tau);
+
+            // The log-strike grid is centered at the spot
+            T b = (T)N * lambda / (T)2.;
+            T logStrikeStart = logSpot - b;
+
+            std::complex<T> i((T)0., (T)1.);
+
+            std::vector<std::complex<T>> grid(N);
+
+            for (int j = 0; j < N; j++) {
+
+              T v = eta * (T)j;
+
+              // The damped call transform of Carr and Madan (1999)
+              std::complex<T> numerator = discount * this->_characteristicFunction(std::complex<T>(v, -(alpha + (T)1.)), St, tau, this->_r, this->_vol);
+              std::complex<T> denominator(alpha * alpha + alpha - v * v, ((T)2. * alpha + (T)1.) * v);
+
+              // Simpson weights on the frequency grid
+              T weight = j == 0 ? (T)1. / (T)3. : ((T)3. + (j % 2 == 0 ? (T)-1. : (T)1.)) / (T)3.;
+
+              // The phase factor shifts the transform onto the grid starting at 'logStrikeStart'
+              grid[j] = std::exp(-i * v * logStrikeStart) * numerator / denominator * eta * weight;
+
+            }
+
+            quantpy::math::fourier::fft<T>(grid.data(), N);
+
+            // Interpolate the requested strikes linearly in log strike
+            for (int idx = 0; idx < n; idx++) {
+
+              T logStrike = log(K[idx]);
+              T position  = (logStrike - logStrikeStart) / lambda;
+
+              if ( position < (T)0. || position > (T)(N - 1) ) {
+                ERROR("The strike falls outside the transform grid! (", K[idx], ")");
+              }
+
+              int lower = (int)position;
+              int upper = lower + 1 < N ? lower + 1 : lower;
+
+              T fraction = position - (T)lower;
+
+              T callLower = exp(-alpha * (logStrikeStart + lambda * (T)lower)) / (T)PI * grid[lower].real();
+              T callUpper = exp(-alpha * (logStrikeStart + lambda * (T)upper)) / (T)PI * grid[upper].real();
+
+              T callPrice = ((T)1. - fraction) * callLower + fraction * callUpper;
+
+              out[idx] = isCall ? callPrice : callPrice - St + K[idx] * discount;
+
+            }
+
+          }
+
+
+          /**
+           * @brief The pricing method
+           * @details Prices through the strike chain with a single requested strike. When many strikes
+           * share an expiry the 'priceChain' method should be used instead, as each call here pays for
+           * the full transform
+           * @param St   The market price of the underlying
+           * @param tau  The time to maturity in years
+           * @param r    The risk-free rate. Not considered in the pricing
+           * @param vol  The volatility. Not considered in the pricing
+           * @returns    The price of the option
+           */
+          T operator() (T St, T tau, T r = (T)-1., T vol = (T)-1.) const override {
+
+            T price;
+            this->priceChain(St, tau, &this->_K, &price, 1, this->_isCall);
+
+            return price;
+
+          }
+
+      };
+
+
+    }
+
+  }
+
+}
+
+
+#endif
@@ -0,0 +1,142 @@
+/**
+ * @file CarrMadan_tests.cpp
+ * @brief Definition of tests for the Carr-Madan FFT option pricer
+ * @details Compile in the main quantpy directory with:
+ * > g++ -std=c++17 -mavx -fopenmp -Wall quantpy/instruments/EuropeanOption/pricers/CarrMadan/tests/CarrMadan_tests.cpp -lm -o CarrMadan_tests.o
+ * Run with:
+ * > ./CarrMadan_tests.o
+ * @author Kasper Rantamäki
+ * @date 2026-08-29
+ */
+
+#include "../CarrMadan.hpp"
+#include "../../BlackScholes/BlackScholes.hpp"
+#include "../../../../../cpp/testing.hpp"
+#include "../../../../../cpp/logging.hpp"
+
+
+// The transform grid and interpolation limit the accuracy to around 1e-4
+#ifndef TEST_TOL
+  #define TEST_TOL 1e-3
+#endif
+
+
+namespace quantpy {
+
+  namespace instruments {
+
+    namespace EuropeanOption {
+
+      namespace CarrMadan_tests {
+
+
+        // Test 1
+        bool test_price1() {
+
+          CarrMadan pricer = CarrMadan<double>(0.04, 120., 0.2, true);
+
+          double correctPrice = 7.0922196;
+          double foundPrice   = pricer(105., 1.5);
+
+          DEBUG("Found price: ", foundPrice);
+
+          return fabs(foundPrice - correctPrice) < TEST_TOL;
+
+        }
+
+
+        // Test 2
+        bool test_price2() {
+
+          CarrMadan pricer = CarrMadan<double>(0.04, 120., 0.2, false);
+
+          double correctPrice = 15.1041072;
+          double foundPrice   = pricer(105., 1.5);
+
+          DEBUG("Found price: ", foundPrice);
+
+          return fabs(foundPrice - correctPrice) < TEST_TOL;
+
+        }
+
+
+        // Test 3
+        bool test_priceChain1() {
+
+          CarrMadan fftPricer = CarrMadan<double>(0.04, 120., 0.2, true);
+
+          // A strike chain spanning deep in-the-money to deep out-of-the-money
+          double strikes[9] = { 60., 75., 90., 100., 105., 110., 120., 135., 150. };
+          double foundPrices[9];
+
+          fftPricer.priceChain(105., 1.5, strikes, foundPrices, 9);
+
+          bool passed = true;
+
+          for (int i = 0; i < 9; i++) {
+
+            BlackScholes analyticPricer = BlackScholes<double>(0.04, strikes[i], 0.2, true);
+            double correctPrice = analyticPricer(105., 1.5);
+
+            DEBUG("Found price: ", foundPrices[i], " (correct: ", correctPrice, ")");
+
+            passed = passed && ( fabs(foundPrices[i] - correctPrice) < TEST_TOL );
+
+          }
+
+          return passed;
+
+        }
+
+
+        // Test 4
+        bool test_priceChain2() {
+
+          CarrMadan fftPricer = CarrMadan<double>(0.04, 120., 0.2, true);
+
+          double strikes[5] = { 80., 95., 105., 115., 130. };
+          double foundPrices[5];
+
+          fftPricer.priceChain(105., 1.5, strikes, foundPrices, 5, false);
+
+          bool passed = true;
+
+          for (int i = 0; i < 5; i++) {
+
+            BlackScholes analyticPricer = BlackScholes<double>(0.04, strikes[i], 0.2, false);
+            double correctPrice = analyticPricer(105., 1.5);
+
+            DEBUG("Found price: ", foundPrices[i], " (correct: ", correctPrice, ")");
+
+            passed = passed && ( fabs(foundPrices[i] - correctPrice) < TEST_TOL );
+
+          }
+
+          return passed;
+
+        }
+
+
+      }
+
+    }
+
+  }
+
+}
+
+
+int main() {
+
+  quantpy::cpp::logging::verbosity(3);
+
+  quantpy::cpp::testing::TestSuite carrMadanTests = quantpy::cpp::testing::TestSuite("CarrMadan.hpp");
+
+  carrMadanTests.addTest(quantpy::instruments::EuropeanOption::CarrMadan_tests::test_price1);
+  carrMadanTests.addTest(quantpy::instruments::EuropeanOption::CarrMadan_tests::test_price2);
+  carrMadanTests.addTest(quantpy::instruments::EuropeanOption::CarrMadan_tests::test_priceChain1);
+  carrMadanTests.addTest(quantpy::instruments::EuropeanOption::CarrMadan_tests::test_priceChain2);
+
+  return (int)carrMadanTests.runTests();
+
+}
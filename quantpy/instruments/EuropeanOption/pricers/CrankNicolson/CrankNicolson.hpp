@@ -0,0 +1,474 @@
+/**
+ * @file CrankNicolson.hpp
+ * @brief Finite difference pricer solving the Black-Scholes equation with the Crank-Nicolson scheme
+ * @details Complements the closed form and Monte Carlo pricers with a lattice engine: the
+ * Black-Scholes equation is solved backwards in time on a uniform log-spot grid, giving the option
+ * value on the whole spot grid from one solve. The tridiagonal Crank-Nicolson systems share one
+ * matrix across all of the time steps, so the Thomas elimination coefficients are prefactored once
+ * and each step reduces to two contiguous sweeps over the grid. A solve of a few hundred grid
+ * points matches Monte Carlo estimates needing millions of trials, and unlike the closed forms the
+ * scheme extends to early exercise and discrete dividends
+ * [1]: P. Wilmott, S. Howison and J. Dewynne. "The Mathematics of Financial Derivatives",
+ * Cambridge University Press, 1995
+ * @author Kasper Rantamäki
+ * @date 2026-08-29
+ */
+
+#ifndef CRANK_NICOLSON_HPP
+#define CRANK_NICOLSON_HPP
+
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "../../../../cpp/logging.hpp"
+#include "../BaseEuropeanOptionPricer.hpp"
+
+
+namespace quantpy {
+
+  namespace instruments {
+
+    namespace EuropeanOption {
+
+
+      /**
+       * @brief The option value on the whole log-spot grid at a given time to maturity
+       * @details One backward solve yields the value at every spot level at once, so the struct
+       * exposes the price, delta and gamma at an arbitrary spot through a local quadratic fit over
+       * the bracketing grid nodes. Spots outside of the grid fall back on the deep in- and
+       * out-of-the-money asymptotics used as the boundary conditions of the solve
+       * @tparam T  The template type. Should be some floating point number type
+       */
+      template <typename T>
+      struct GridSolution {
+
+        T x0;              /**< The log-spot of the first grid node */
+        T dx;              /**< The uniform log-spot grid spacing */
+        T tau;             /**< The time to maturity of the solution in years */
+        T r;               /**< The (continuously compounding) risk-free rate used in the solve */
+        T K;               /**< The strike price of the option */
+        bool isCall;       /**< Boolean flag telling if the option is a call or a put */
+        std::vector<T> v;  /**< The option values on the grid nodes */
+
+
+        /**
+         * @brief The price of the option at a given spot read off the grid
+         * @param St  The market price of the underlying
+         * @returns   The price of the option
+         */
+        T price(T St) const {
+
+          T x = log(St);
+          int n = (int)this->v.size();
+
+          if ( x <= this->x0 ) {
+            return this->isCall ? (T)0. : this->K * exp(-this->r * this->tau) - St;
+          }
+
+          if ( x >= this->x0 + (n - 1) * this->dx ) {
+            return this->isCall ? St - this->K * exp(-this->r * this->tau) : (T)0.;
+          }
+
+          int i = std::min(std::max((int)round((x - this->x0) / this->dx), 1), n - 2);
+          T s = (x - (this->x0 + i * this->dx)) / this->dx;
+
+          // Local quadratic through the bracketing nodes
+          return this->v[i] + s * (this->v[i + 1] - this->v[i - 1]) / (T)2. +
+                 s * s * (this->v[i + 1] - (T)2. * this->v[i] + this->v[i - 1]) / (T)2.;
+
+        }
+
+
+        /**
+         * @brief The delta of the option at a given spot read off the grid
+         * @details The log-spot derivative of the local quadratic fit divided by the spot, as
+         * \f$ \partial V / \partial S = (\partial V / \partial x) / S \f$
+         * @param St  The market price of the underlying
+         * @returns   The delta of the option
+         */
+        T delta(T St) const {
+
+          T x = log(St);
+          int n = (int)this->v.size();
+
+          if ( x <= this->x0 ) {
+            return this->isCall ? (T)0. : (T)-1.;
+          }
+
+          if ( x >= this->x0 + (n - 1) * this->dx ) {
+            return this->isCall ? (T)1. : (T)0.;
+          }
+
+          int i = std::min(std::max((int)round((x - this->x0) / this->dx), 1), n - 2);
+          T s = (x - (this->x0 + i * this->dx)) / this->dx;
+
+          T dvdx = ((this->v[i + 1] - this->v[i - 1]) / (T)2. +
+                    s * (this->v[i + 1] - (T)2. * this->v[i] + this->v[i - 1])) / this->dx;
+
+          return dvdx / St;
+
+        }
+
+
+        /**
+         * @brief The gamma of the option at a given spot read off the grid
+         * @details Follows from the chain rule on the log-spot grid as
+         * \f$ \partial^2 V / \partial S^2 = (\partial^2 V / \partial x^2 - \partial V / \partial x) / S^2 \f$
+         * @param St  The market price of the underlying
+         * @returns   The gamma of the option
+         */
+        T gamma(T St) const {
+
+          T x = log(St);
+          int n = (int)this->v.size();
+
+          if ( x <= this->x0 || x >= this->x0 + (n - 1) * this->dx ) {
+            return (T)0.;
+          }
+
+          int i = std::min(std::max((int)round((x - this->x0) / this->dx), 1), n - 2);
+          T s = (x - (this->x0 + i * this->dx)) / this->dx;
+
+          T d2vdx2 = (this->v[i + 1] - (T)2. * this->v[i] + this->v[i - 1]) / (this->dx * this->dx);
+          T dvdx   = ((this->v[i + 1] - this->v[i - 1]) / (T)2. +
+                      s * (this->v[i + 1] - (T)2. * this->v[i] + this->v[i - 1])) / this->dx;
+
+          return (d2vdx2 - dvdx) / (St * St);
+
+        }
+
+      };
+
+
+      /**
+       * @brief Finite difference pricer based on the Crank-Nicolson scheme on a log-spot grid
+       * @details The scheme is second order in both the grid spacing and the time step. The first
+       * two steps are taken with the fully implicit Euler scheme (the Rannacher startup), which
+       * damps the oscillations the non-smooth payoff would otherwise feed into the gamma near the
+       * strike. The latest grid solution is cached on the pricer, so repricing across spot levels
+       * of the same expiry costs one interpolation instead of a new solve
+       * @tparam T  The template type. Should be some floating point number type
+       */
+      template <typename T>
+      class CrankNicolson : public BaseEuropeanOptionPricer<T> {
+
+        protected:
+
+          int _nGrid;   /**< The number of log-spot grid nodes */
+          int _nSteps;  /**< The number of time steps */
+
+          mutable GridSolution<T> _solution;  /**< The cached grid solution of the latest solve */
+          mutable bool _solved = false;       /**< Boolean flag telling if the cached solution is valid */
+          mutable T _solvedTau;               /**< The time to maturity of the cached solution */
+          mutable T _solvedR;                 /**< The risk-free rate of the cached solution */
+          mutable T _solvedVol;               /**< The volatility of the cached solution */
+          mutable T _solvedK;                 /**< The strike price of the cached solution */
+          mutable bool _solvedIsCall;         /**< The option type of the cached solution */
+
+
+          /**
+           * @brief Solves the option values on the whole grid backwards from the payoff
+           * @details The grid spans five volatility standard deviations around the log strike. As
+           * the tridiagonal matrix is shared by every time step, the Thomas elimination
+           * coefficients are prefactored once per scheme and each step costs one forward and one
+           * backward sweep over contiguous arrays
+           * @param tau  The time to maturity in years
+           * @param r    The (continuously compounding) risk-free rate
+           * @param vol  The volatility
+           * @param sol  The grid solution object into which the solve is written
+           * @returns    Void. The solution is written into the 'sol' object
+           */
+          void _solveGrid(T tau, T r, T vol, GridSolution<T>& sol) const {
+
+            if ( tau <= (T)0. ) {
+              ERROR("The time to maturity must be positive! (", tau, " <= 0)");
+            }
+
+            int nX = this->_nGrid;
+            int nT = this->_nSteps;
+            int m = nX - 2;
+
+            T width = std::max((T)5. * vol * sqrt(tau), (T)1.);
+            T dx = (T)2. * width / (T)(nX - 1);
+            T dt = tau / (T)nT;
+
+            sol.x0     = log(this->_K) - width;
+            sol.dx     = dx;
+            sol.tau    = tau;
+            sol.r      = r;
+            sol.K      = this->_K;
+            sol.isCall = this->_isCall;
+            sol.v.resize(nX);
+
+            // The terminal condition is the payoff on the grid
+            for (int i = 0; i < nX; i++) {
+              T S = exp(sol.x0 + i * dx);
+              sol.v[i] = this->_isCall ? std::max(S - this->_K, (T)0.) : std::max(this->_K - S, (T)0.);
+            }
+
+            T a = vol * vol / ((T)2. * dx * dx);
+            T b = (r - vol * vol / (T)2.) / ((T)2. * dx);
+
+            // The two schemes share the spatial operator but weight it differently: the implicit
+            // Euler startup puts it fully on the left hand side, Crank-Nicolson half on each
+            T lCN = -dt / (T)2. * (a - b);
+            T dCN = (T)1. + dt / (T)2. * ((T)2. * a + r);
+            T uCN = -dt / (T)2. * (a + b);
+
+            T lIE = -dt * (a - b);
+            T dIE = (T)1. + dt * ((T)2. * a + r);
+            T uIE = -dt * (a + b);
+
+            // Prefactored Thomas elimination coefficients for both schemes
+            std::vector<T> cpCN(m), invCN(m), cpIE(m), invIE(m);
+
+            invCN[0] = (T)1. / dCN;
+            cpCN[0]  = uCN * invCN[0];
+            invIE[0] = (T)1. / dIE;
+            cpIE[0]  = uIE * invIE[0];
+
+            for (int i = 1; i < m; i++) {
+              invCN[i] = (T)1. / (dCN - lCN * cpCN[i - 1]);
+              cpCN[i]  = uCN * invCN[i];
+              invIE[i] = (T)1. / (dIE - lIE * cpIE[i - 1]);
+              cpIE[i]  = uIE * invIE[i];
+            }
+
+            std::vector<T> d(m);
+
+            for (int step = 1; step <= nT; step++) {
+
+              // The Rannacher startup takes the first two steps with the implicit Euler scheme
+              bool rannacher = step <= 2;
+
+              T l = rannacher ? lIE : lCN;
+              const std::vector<T>& cp = rannacher ? cpIE : cpCN;
+              const std::vector<T>& inv = rannacher ? invIE : invCN;
+
+              T tau_s = step * dt;
+              T lowNew, highNew;
+
+              if ( this->_isCall ) {
+                lowNew  = (T)0.;
+                highNew = exp(sol.x0 + (nX - 1) * dx) - this->_K * exp(-r * tau_s);
+              }
+              else {
+                lowNew  = this->_K * exp(-r * tau_s) - exp(sol.x0);
+                highNew = (T)0.;
+              }
+
+              if ( rannacher ) {
+                for (int i = 0; i < m; i++) {
+                  d[i] = sol.v[i + 1];
+                }
+              }
+              else {
+                for (int i = 0; i < m; i++) {
+                  d[i] = -lCN * sol.v[i] + ((T)2. - dCN) * sol.v[i + 1] - uCN * sol.v[i + 2];
+                }
+              }
+
+              d[0]     -= l * lowNew;
+              d[m - 1] -= (rannacher ? uIE : uCN) * highNew;
+
+              // Thomas forward sweep against the prefactored coefficients
+              d[0] *= inv[0];
+
+              for (int i = 1; i < m; i++) {
+                d[i] = (d[i] - l * d[i - 1]) * inv[i];
+              }
+
+              // Backward substitution straight into the grid values
+              sol.v[0]      = lowNew;
+              sol.v[nX - 1] = highNew;
+              sol.v[m]      = d[m - 1];
+
+              for (int i = m - 2; i >= 0; i--) {
+                sol.v[i + 1] = d[i] - cp[i] * sol.v[i + 2];
+              }
+
+            }
+
+          }
+
+        public:
+
+          /**
+           * @brief Default constructor
+           * @returns  Uninitialized CrankNicolson object
+           */
+          CrankNicolson() : _nGrid(501), _nSteps(500) {  }
+
+
+          /**
+           * @brief Main constructor
+           * @param r       The (continuously compounding) risk-free rate
+           * @param K       The strike price
+           * @param vol     The volatility
+           * @param isCall  Boolean flag telling if the option is a call or a put. Defaults to 'true'
+           * @param nGrid   The number of log-spot grid nodes. Defaults to 501
+           * @param nSteps  The number of time steps. Defaults to 500
+           * @returns       Inititalized CrankNicolson object
+           */
+          CrankNicolson(T r, T K, T vol, bool isCall = true, int nGrid = 501, int nSteps = 500) {
+
+            if ( nGrid < 3 ) {
+              ERROR("The grid needs at least three nodes! (", nGrid, " < 3)");
+            }
+
+            if ( nSteps < 3 ) {
+              ERROR("The scheme needs at least three time steps! (", nSteps, " < 3)");
+            }
+
+            this->_r = r;
+            this->_K = K;
+            this->_vol = vol;
+            this->_isCall = isCall;
+            this->_nGrid = nGrid;
+            this->_nSteps = nSteps;
+
+          }
+
+
+          /**
+           * @brief Getter for the number of log-spot grid nodes
+           * @returns The number of grid nodes
+           */
+          const int& nGrid() const { return this->_nGrid; }
+
+
+          /**
+           * @brief Getter for the number of time steps
+           * @returns The number of time steps
+           */
+          const int& nSteps() const { return this->_nSteps; }
+
+
+          /**
+           * @brief The grid solution of the option for a given time to maturity
+           * @details The solution is cached on the pricer and only recomputed when the expiry or
+           * the stored parameters change, so querying prices and Greeks across spot levels of the
+           * same expiry costs one solve in total
+           * @param tau  The time to maturity in years
+           * @returns    Constant reference to the cached grid solution
+           */
+          const GridSolution<T>& solution(T tau) const {
+
+            bool valid = this->_solved && this->_solvedTau == tau && this->_solvedR == this->_r &&
+                         this->_solvedVol == this->_vol && this->_solvedK == this->_K &&
+                         this->_solvedIsCall == this->_isCall;
+
+            if ( !valid ) {
+
+              this->_solveGrid(tau, this->_r, this->_vol, this->_solution);
+
+              this->_solved       = true;
+              this->_solvedTau    = tau;
+              this->_solvedR      = this->_r;
+              this->_solvedVol    = this->_vol;
+              this->_solvedK      = this->_K;
+              this->_solvedIsCall = this->_isCall;
+
+            }
+
+            return this->_solution;
+
+          }
+
+
+          /**
+           * @brief The pricing method
+           * @details Bumped rates and volatilities bypass the cache with a standalone solve, so
+           * e.g. the finite difference vega of the base class does not evict the cached solution
+           * @param St   The market price of the underlying
+           * @param tau  The time to maturity in years
+           * @param r    The risk-free rate. Defaults to the one used to initialize the object
+           * @param vol  The volatility. Defaults to the one used to initialize the object
+           * @returns    The price of the option
+           */
+          T operator() (T St, T tau, T r = (T)-1., T vol = (T)-1.) const override {
+
+            if ( r == (T)-1. && vol == (T)-1. ) {
+              return this->solution(tau).price(St);
+            }
+
+            GridSolution<T> sol;
+            this->_solveGrid(tau, r != (T)-1. ? r : this->_r, vol != (T)-1. ? vol : this->_vol, sol);
+
+            return sol.price(St);
+
+          }
+
+
+          /**
+           * @brief Calculates the option delta from the grid solution
+           * @details Overrides the finite difference fallback of the base class: the delta is read
+           * off the cached grid solution, so no repricing solves are needed
+           * @param St   The market price of the underlying
+           * @param tau  The time to maturity in years
+           * @param h    The finite difference step size. Not considered in the calculation
+           * @returns    The delta of the option
+           */
+          const T delta(T St, T tau, T h = 1e-6) const override {
+
+            return this->solution(tau).delta(St);
+
+          }
+
+
+          /**
+           * @brief Calculates the option gamma from the grid solution
+           * @details Overrides the finite difference fallback of the base class: the gamma is read
+           * off the cached grid solution, so no repricing solves are needed
+           * @param St   The market price of the underlying
+           * @param tau  The time to maturity in years
+           * @param h    The finite difference step size. Not considered in the calculation
+           * @returns    The gamma of the option
+           */
+          const T gamma(T St, T tau, T h = 1e-6) const override {
+
+            return this->solution(tau).gamma(St);
+
+          }
+
+
+          /**
+           * @brief Calculates the price and all of the Greeks in one pass
+           * @details The price, delta and gamma are read off one grid solution, so only the vega,
+           * rho and theta stencils need further solves. This totals seven solves instead of the
+           * thirteen needed by the finite difference default of the base class
+           * @param St   The market price of the underlying
+           * @param tau  The time to maturity in years
+           * @param h    The finite difference step size. Defaults to 1e-6
+           * @returns    A Greeks object holding the price and all of the Greeks
+           */
+          Greeks<T> evaluate(T St, T tau, T h = 1e-6) const override {
+
+            const GridSolution<T>& sol = this->solution(tau);
+
+            Greeks<T> greeks;
+
+            greeks.price = sol.price(St);
+            greeks.delta = sol.delta(St);
+            greeks.gamma = sol.gamma(St);
+            greeks.vega  = (this->operator() (St, tau, this->_r, this->_vol + h) - this->operator() (St, tau, this->_r, this->_vol - h)) / ((T)2. * h);
+            greeks.rho   = (this->operator() (St, tau, this->_r + h) - this->operator() (St, tau, this->_r - h)) / ((T)2. * h);
+            greeks.theta = (this->operator() (St, tau + h) - this->operator() (St, tau - h)) / ((T)2. * h);
+
+            return greeks;
+
+          }
+
+      };
+
+
+    }
+
+  }
+
+}
+
+
+#endif
@@ -0,0 +1,199 @@
+/**
+ * @file CrankNicolson_tests.cpp
+ * @brief Definition of tests for the Crank-Nicolson finite difference pricer
+ * @details Compile in the main quantpy directory with:
+ * > g++ -std=c++17 -mavx -fopenmp -Wall quantpy/instruments/EuropeanOption/pricers/CrankNicolson/tests/CrankNicolson_tests.cpp -lm -o CrankNicolson_tests.o
+ * Run with:
+ * > ./CrankNicolson_tests.o
+ * @author Kasper Rantamäki
+ * @date 2026-08-29
+ */
+
+
+#include <cmath>
+
+#include "../CrankNicolson.hpp"
+#include "../../BlackScholes/BlackScholes.hpp"
+#include "../../../../../cpp/testing.hpp"
+#include "../../../../../cpp/logging.hpp"
+
+
+// The tolerance accounts for the discretization error of the default 501 by 500 grid
+#ifndef TEST_TOL
+  #define TEST_TOL 1e-3
+#endif
+
+
+namespace quantpy {
+
+  namespace instruments {
+
+    namespace CrankNicolson_tests {
+
+
+      // Test 1
+      bool test_price1() {
+
+        // The scheme should reproduce the closed form call price across moneyness
+        EuropeanOption::CrankNicolson<double> pricer(0.04, 100., 0.2, true);
+        EuropeanOption::BlackScholes<double> correct(0.04, 100., 0.2, true);
+
+        bool passed = true;
+
+        for (double St = 80.; St <= 120.; St += 5.) {
+          DEBUG("Found price: ", pricer(St, 1.5), " (correct ", correct(St, 1.5), ")");
+          passed = passed && ( fabs(pricer(St, 1.5) - correct(St, 1.5)) < TEST_TOL );
+        }
+
+        return passed;
+
+      }
+
+
+      // Test 2
+      bool test_price2() {
+
+        // The scheme should reproduce the closed form put price across moneyness
+        EuropeanOption::CrankNicolson<double> pricer(0.04, 100., 0.2, false);
+        EuropeanOption::BlackScholes<double> correct(0.04, 100., 0.2, false);
+
+        bool passed = true;
+
+        for (double St = 80.; St <= 120.; St += 5.) {
+          DEBUG("Found price: ", pricer(St, 1.5), " (correct ", correct(St, 1.5), ")");
+          passed = passed && ( fabs(pricer(St, 1.5) - correct(St, 1.5)) < TEST_TOL );
+        }
+
+        return passed;
+
+      }
+
+
+      // Test 3
+      bool test_greeks1() {
+
+        // The delta and gamma read off the grid should match the closed form values
+        EuropeanOption::CrankNicolson<double> pricer(0.04, 100., 0.2, true);
+        EuropeanOption::BlackScholes<double> correct(0.04, 100., 0.2, true);
+
+        bool passed = true;
+
+        for (double St = 80.; St <= 120.; St += 5.) {
+          passed = passed && ( fabs(pricer.delta(St, 1.5) - correct.delta(St, 1.5)) < TEST_TOL );
+          passed = passed && ( fabs(pricer.gamma(St, 1.5) - correct.gamma(St, 1.5)) < TEST_TOL );
+        }
+
+        return passed;
+
+      }
+
+
+      // Test 4
+      bool test_evaluate1() {
+
+        // The fused evaluation should agree with the closed form price and Greeks
+        EuropeanOption::CrankNicolson<double> pricer(0.04, 100., 0.2, true);
+        EuropeanOption::BlackScholes<double> correct(0.04, 100., 0.2, true);
+
+        EuropeanOption::Greeks<double> found = pricer.evaluate(105., 1.5);
+        EuropeanOption::Greeks<double> correctGreeks = correct.evaluate(105., 1.5);
+
+        DEBUG("Found price: ", found.price, " (correct ", correctGreeks.price, ")");
+
+        bool passed = ( fabs(found.price - correctGreeks.price) < TEST_TOL );
+
+        passed = passed && ( fabs(found.delta - correctGreeks.delta) < TEST_TOL );
+        passed = passed && ( fabs(found.gamma - correctGreeks.gamma) < TEST_TOL );
+        // The bumped resolves behind the remaining Greeks compound the discretization error
+        passed = passed && ( fabs(found.vega - correctGreeks.vega) < 1e-2 );
+        passed = passed && ( fabs(found.rho - correctGreeks.rho) < 1e-2 );
+        passed = passed && ( fabs(found.theta - correctGreeks.theta) < 1e-2 );
+
+        return passed;
+
+      }
+
+
+      // Test 5
+      bool test_solution1() {
+
+        // Repricing the same expiry should reuse the cached grid solution
+        EuropeanOption::CrankNicolson<double> pricer(0.04, 100., 0.2, true);
+
+        const EuropeanOption::GridSolution<double>& sol1 = pricer.solution(1.5);
+        const double* values = sol1.v.data();
+
+        pricer(95., 1.5);
+        pricer(110., 1.5);
+
+        const EuropeanOption::GridSolution<double>& sol2 = pricer.solution(1.5);
+
+        return ( &sol1 == &sol2 ) && ( sol2.v.data() == values );
+
+      }
+
+
+      // Test 6
+      bool test_solution2() {
+
+        // One grid solution should price a whole strip of spot levels consistently
+        EuropeanOption::CrankNicolson<double> pricer(0.04, 100., 0.2, true);
+        EuropeanOption::BlackScholes<double> correct(0.04, 100., 0.2, true);
+
+        const EuropeanOption::GridSolution<double>& sol = pricer.solution(1.5);
+
+        bool passed = true;
+
+        for (double St = 70.; St <= 140.; St += 2.5) {
+          passed = passed && ( fabs(sol.price(St) - correct(St, 1.5)) < TEST_TOL );
+        }
+
+        return passed;
+
+      }
+
+
+      // Test 7
+      bool test_parity1() {
+
+        // The call and put solves should satisfy the put-call parity
+        EuropeanOption::CrankNicolson<double> call(0.04, 100., 0.2, true);
+        EuropeanOption::CrankNicolson<double> put(0.04, 100., 0.2, false);
+
+        double St = 105.;
+        double tau = 1.5;
+
+        double found = call(St, tau) - put(St, tau);
+        double correctValue = St - 100. * exp(-0.04 * tau);
+
+        DEBUG("Found parity value: ", found, " (correct ", correctValue, ")");
+
+        return fabs(found - correctValue) < TEST_TOL;
+
+      }
+
+
+    }
+
+  }
+
+}
+
+
+int main() {
+
+  quantpy::cpp::logging::verbosity(3);
+
+  quantpy::cpp::testing::TestSuite crankNicolsonTests = quantpy::cpp::testing::TestSuite("CrankNicolson.hpp");
+
+  crankNicolsonTests.addTest(quantpy::instruments::CrankNicolson_tests::test_price1);
+  crankNicolsonTests.addTest(quantpy::instruments::CrankNicolson_tests::test_price2);
+  crankNicolsonTests.addTest(quantpy::instruments::CrankNicolson_tests::test_greeks1);
+  crankNicolsonTests.addTest(quantpy::instruments::CrankNicolson_tests::test_evaluate1);
+  crankNicolsonTests.addTest(quantpy::instruments::CrankNicolson_tests::test_solution1);
+  crankNicolsonTests.addTest(quantpy::instruments::CrankNicolson_tests::test_solution2);
+  crankNicolsonTests.addTest(quantpy::instruments::CrankNicolson_tests::test_parity1);
+
+  return (int)crankNicolsonTests.runTests();
+
+}
@@ -27,6 +27,8 @@
 #include <omp.h>
 
 #include "../../../../cpp/logging.hpp"
+#include "../../../../cpp/profiling.hpp"
+#include "../../../../cpp/reduction.hpp"
 #include "../../../../math/probability/gamma.hpp"
 #include "../../../../math/optimization/rootFinding.hpp"
 #include "../BaseEuropeanOptionPricer.hpp"
@@ -56,7 +58,9 @@ namespace quantpy {
       template <typename T>
       T __complimentaryGammaDist(T shape, T rate, T x) {
 
-        return (T)1. - quantpy::math::probability::gamma::cdf(shape, rate, x);
+        // Evaluated through the regularized upper incomplete gamma directly, which retains full
+        // relative accuracy in the tail where the complement of the cdf would cancel to zero
+        return quantpy::math::special::regularizedUpperIncompleteGamma(shape, rate * x);
 
       }
 
@@ -98,26 +102,40 @@ namespace quantpy {
 
       /**
        * @brief General CEV pricing function. To be called by the 'GeneralCEV' class
-       * @tparam T      The template type. Should be some floating point type
-       * @param St      The market price of the underlying
-       * @param tau     The time to maturity in years
-       * @param r       The (continuously compounding) risk-free rate
-       * @param K       The strike price
-       * @param vol     The volatility 
-       * @param alpha   The elasticity factor
-       * @param isCall  Boolean flag telling if the option is a call or a put. Defaults to 'true'
-       * @param n       The upper bound for the infinite sum. Defaults to 10000 (should be enough according to Beckers (1980))
-       * @returns       The price of a call option under the CEV model
+       * @details With a positive tolerance the sums are evaluated with term recurrences: consecutive
+       * gamma densities satisfy \f$ g(a + 1, x) = g(a, x) x / a \f$ and the complimentary gamma
+       * distributions \f$ G(a + 1, y) = G(a, y) + g(a + 1, y) \f$, so each term costs a couple of
+       * multiplications instead of fresh pow/tgamma/exp evaluations. The densities are carried in
+       * log space to keep the recurrences stable for large arguments. The summation terminates once
+       * the terms have passed their peak and fall below the relative tolerance, which per Beckers (1980)
+       * typically happens after a few tens of terms. A non-positive tolerance recovers the original
+       * fixed term count evaluation for validation
+       * @tparam T         The template type. Should be some floating point type
+       * @param St         The market price of the underlying
+       * @param tau        The time to maturity in years
+       * @param r          The (continuously compounding) risk-free rate
+       * @param K          The strike price
+       * @param vol        The volatility
+       * @param alpha      The elasticity factor
+       * @param isCall     Boolean flag telling if the option is a call or a put. Defaults to 'true'
+       * @param n          The upper bound for the infinite sum. Defaults to 10000 (should be enough according to Beckers (1980))
+       * @param tol        The relative tolerance at which the sums are terminated. Non-positive values disable
+       * the early termination and evaluate all 'n' terms. Defaults to 1e-10
+       * @param termsUsed  Optional pointer into which the achieved term count is written. Defaults to nullptr
+       * @returns          The price of a call option under the CEV model
        */
       template <typename T>
-      T __GeneralCEVPrice(T St, T tau, T r, T K, T vol, T alpha, bool isCall = true, int n = 10000) {
+      T __GeneralCEVPrice(T St, T tau, T r, T K, T vol, T alpha, bool isCall = true, int n = 10000, T tol = (T)1e-10, int* termsUsed = nullptr) {
+
+        PROFILE_FUNCTION()
 
         if ( n < 1 ) {
           ERROR("The upper bound for the sum needs to be positive! (", n, " < 1)");
         }
 
-        T k = __GeneralCEVk<T>(tau, r, vol, alpha); 
+        T k = __GeneralCEVk<T>(tau, r, vol, alpha);
         T x = __GeneralCEVx<T>(St, tau, r, vol, alpha);
+        T y = k * pow(K, (T)2. - alpha);
 
         DEBUG("k = ", k, " | x = ", x)
 
@@ -125,29 +143,74 @@ namespace quantpy {
         T firstSum  = (T)0.;
         T secondSum = (T)0.;
 
-        #pragma omp parallel
-        {
+        if ( tol > (T)0. ) {
+
+          T b = (T)1. / ((T)2. - alpha);
+
+          T logx = log(x);
+          T logy = log(y);
+
+          // The log densities log(g(a, .)) at the integer shape a = i + 1 and the shifted shape a = i + 1 + b
+          T logPdfX1 = -x;
+          T logPdfX2 = b * logx - x - lgamma((T)1. + b);
+          T logPdfY1 = -y;
+          T logPdfY2 = b * logy - y - lgamma((T)1. + b);
+
+          // The complimentary gamma distributions G(a, y) at the shifted and integer shapes
+          T Q1 = quantpy::math::special::regularizedUpperIncompleteGamma<T>((T)1. + b, y);
+          T Q2 = quantpy::math::special::regularizedUpperIncompleteGamma<T>((T)1., y);
+
+          int count = n;
 
-          // The sums accumulated within a single thread
-          T firstThreadSum  = (T)0.;
-          T secondThreadSum = (T)0.;
+          for (int i = 0; i < n; i++) {
 
-          #pragma omp for nowait
-          for (int i = 0; i < n; i ++) {
+            T firstTerm  = exp(logPdfX1) * Q1;
+            T secondTerm = exp(logPdfX2) * Q2;
 
-            // Note that with the gamma distribution functions the rate parameter is assumed to be 1
-            // This is in line with how Beckers (1980) defined the functions
-            firstThreadSum  += quantpy::math::probability::gamma::pdf<T>((T)(i + 1), (T)1., x) * __complimentaryGammaDist<T>((T)(i + 1) + (T)1. / ((T)2. - alpha), (T)1., k * pow(K, (T)2. - alpha));
-            secondThreadSum += quantpy::math::probability::gamma::pdf<T>((T)(i + 1) + (T)1. / ((T)2. - alpha), (T)1., x) * __complimentaryGammaDist<T>((T)(i + 1), (T)1., k * pow(K, (T)2. - alpha));
+            firstSum  += firstTerm;
+            secondSum += secondTerm;
+
+            // The terms grow until the shape parameter passes the density peak at x, after which
+            // they decay monotonically and the relative stopping rule is safe to apply
+            if ( (T)(i + 1) > x && firstTerm + secondTerm < tol * (firstSum + secondSum) ) {
+              count = i + 1;
+              break;
+            }
+
+            // Advance the densities from shape a to a + 1 and accumulate the distributions accordingly
+            logPdfX1 += logx - log((T)(i + 1));
+            logPdfX2 += logx - log((T)(i + 1) + b);
+            logPdfY1 += logy - log((T)(i + 1));
+            logPdfY2 += logy - log((T)(i + 1) + b);
+
+            Q1 += exp(logPdfY2);
+            Q2 += exp(logPdfY1);
 
           }
 
-          #pragma omp critical
-          {
-            // Accumulate the total sums without race conditions
-            firstSum  += firstThreadSum;
-            secondSum += secondThreadSum;
+          DEBUG("Terms used: ", count)
+
+          if ( termsUsed != nullptr ) {
+            *termsUsed = count;
           }
+
+        }
+        else {
+
+          // Note that with the gamma distribution functions the rate parameter is assumed to be 1
+          // This is in line with how Beckers (1980) defined the functions
+          firstSum = quantpy::cpp::reduction::parallelSum<T>(n, [&](int i) {
+            return quantpy::math::probability::gamma::pdf<T>((T)(i + 1), (T)1., x) * __complimentaryGammaDist<T>((T)(i + 1) + (T)1. / ((T)2. - alpha), (T)1., y);
+          });
+
+          secondSum = quantpy::cpp::reduction::parallelSum<T>(n, [&](int i) {
+            return quantpy::math::probability::gamma::pdf<T>((T)(i + 1) + (T)1. / ((T)2. - alpha), (T)1., x) * __complimentaryGammaDist<T>((T)(i + 1), (T)1., y);
+          });
+
+          if ( termsUsed != nullptr ) {
+            *termsUsed = n;
+          }
+
         }
 
         T callPrice = St * firstSum - K * exp(-r * tau) * secondSum;
@@ -174,20 +237,22 @@ namespace quantpy {
        * @param n           The upper bound for the infinite sum. Defaults to 10000 (should be enough according to Beckers (1980))
        * @param lowerBound  The lower bound for the volatility. Defaults to 1e-6
        * @param upperBound  The upper bound for the volatility. Defaults to 10
+       * @param tol         The relative tolerance at which the sums are terminated. Non-positive values disable
+       * the early termination and evaluate all 'n' terms. Defaults to 1e-10
        * @returns           The implied volatility of the option
        */
       template <typename T>
-      T __GeneralCEVImpliedVol(T Vt, T St, T tau, T r, T K, T alpha, bool isCall = true, int n = 10000, T lowerBound = (T)1e-6, T upperBound = (T)10.) {
+      T __GeneralCEVImpliedVol(T Vt, T St, T tau, T r, T K, T alpha, bool isCall = true, int n = 10000, T lowerBound = (T)1e-6, T upperBound = (T)10., T tol = (T)1e-10) {
 
         if ( n < 1 ) {
           ERROR("The upper bound for the sum needs to be positive! (", n, " < 1)");
         }
 
         auto targetFunc = [=](T vol) {
-          return Vt - __GeneralCEVPrice(St, tau, r, K, vol, alpha, isCall, n);
+          return Vt - __GeneralCEVPrice(St, tau, r, K, vol, alpha, isCall, n, tol);
         };
 
-        return quantpy::math::optimization::rootFinding::bisectionMethod<T>(targetFunc, lowerBound, upperBound);
+        return quantpy::math::optimization::rootFinding::brentMethod<T>(targetFunc, lowerBound, upperBound);
 
       }
 
@@ -200,9 +265,11 @@ namespace quantpy {
       class GeneralCEV : public BaseEuropeanOptionPricer<T> {
 
         protected:
- 
-          T _alpha;  /**< The elasticity factor */
-          int _n;    /**< The upper bound for the sum */
+
+          T _alpha;                     /**< The elasticity factor */
+          int _n;                       /**< The upper bound for the sum */
+          T _tol = (T)1e-10;            /**< The relative tolerance at which the sums are terminated */
+          mutable int _termsUsed = 0;   /**< The term count achieved by the latest pricing call */
 
         public:
 
@@ -221,9 +288,11 @@ namespace quantpy {
            * @param alpha   The elasticity factor
            * @param isCall  Boolean flag telling if the option is a call or a put. Defaults to 'true'
            * @param n       The upper bound for the infinite sum. Defaults to 10000 (should be enough according to Beckers (1980))
+           * @param tol     The relative tolerance at which the sums are terminated. Non-positive values disable
+           * the early termination and evaluate all 'n' terms. Defaults to 1e-10
            * @return        Initialized GeneralCEV object
            */
-          GeneralCEV(T r, T K, T vol, T alpha, bool isCall = true, int n = 10000) {
+          GeneralCEV(T r, T K, T vol, T alpha, bool isCall = true, int n = 10000, T tol = (T)1e-10) {
 
             if ( n < 1 ) {
               ERROR("The upper bound for the sum needs to be positive! (", n, " < 1)");
@@ -235,6 +304,7 @@ namespace quantpy {
             this->_isCall = isCall;
             this->_alpha = alpha;
             this->_n = n;
+            this->_tol = tol;
 
           }
 
@@ -249,16 +319,19 @@ namespace quantpy {
            * @param alpha   The elasticity factor
            * @param isCall  Boolean flag telling if the option is a call or a put. Defaults to 'true'
            * @param n       The upper bound for the infinite sum. Defaults to 10000 (should be enough according to Beckers (1980))
+           * @param tol     The relative tolerance at which the sums are terminated. Non-positive values disable
+           * the early termination and evaluate all 'n' terms. Defaults to 1e-10
            * @returns       Initialized GeneralCEV object
            */
-          GeneralCEV(T Vt, T St, T tau, T r, T K, T alpha, bool isCall = true, int n = 10000) {
+          GeneralCEV(T Vt, T St, T tau, T r, T K, T alpha, bool isCall = true, int n = 10000, T tol = (T)1e-10) {
 
             this->_r = r;
             this->_K = K;
             this->_isCall = isCall;
             this->_alpha = alpha;
             this->_n = n;
-            this->_vol = __GeneralCEVImpliedVol<T>(Vt, St, tau, this->_r, this->_K, this->_alpha, this->_isCall, this->_n, (T)1e-6, (T)10.);
+            this->_tol = tol;
+            this->_vol = __GeneralCEVImpliedVol<T>(Vt, St, tau, this->_r, this->_K, this->_alpha, this->_isCall, this->_n, (T)1e-6, (T)10., this->_tol);
 
           }
 
@@ -291,6 +364,27 @@ namespace quantpy {
           const int& n() const { return this->_n; }
 
 
+          /**
+           * @brief Setter for the relative tolerance at which the sums are terminated
+           * @returns The relative tolerance
+           */
+          virtual T& tol() { return this->_tol; }
+
+
+          /**
+           * @brief Getter for the relative tolerance at which the sums are terminated
+           * @returns The relative tolerance
+           */
+          const T& tol() const { return this->_tol; }
+
+
+          /**
+           * @brief Getter for the term count achieved by the latest pricing call
+           * @returns The achieved term count
+           */
+          const int& termsUsed() const { return this->_termsUsed; }
+
+
           /**
            * @brief The pricing method
            * @param St   The market price of the underlying
@@ -302,18 +396,43 @@ namespace quantpy {
           T operator() (T St, T tau, T r = (T)-1., T vol = (T)-1.) const override {
 
             if ( r != (T)-1. && vol != (T)-1. ) {
-              return __GeneralCEVPrice<T>(St, tau, r, this->_K, vol, this->_alpha, this->_isCall, this->_n);
+              return __GeneralCEVPrice<T>(St, tau, r, this->_K, vol, this->_alpha, this->_isCall, this->_n, this->_tol, &this->_termsUsed);
             }
 
             if ( r != (T)-1. ) {
-              return __GeneralCEVPrice<T>(St, tau, r, this->_K, this->_vol, this->_alpha, this->_isCall, this->_n);
+              return __GeneralCEVPrice<T>(St, tau, r, this->_K, this->_vol, this->_alpha, this->_isCall, this->_n, this->_tol, &this->_termsUsed);
             }
 
             if ( vol != (T)-1. ) {
-              return __GeneralCEVPrice<T>(St, tau, this->_r, this->_K, vol, this->_alpha, this->_isCall, this->_n);
+              return __GeneralCEVPrice<T>(St, tau, this->_r, this->_K, vol, this->_alpha, this->_isCall, this->_n, this->_tol, &this->_termsUsed);
             }
 
-            return __GeneralCEVPrice<T>(St, tau, this->_r, this->_K, this->_vol, this->_alpha, this->_isCall, this->_n);
+            return __GeneralCEVPrice<T>(St, tau, this->_r, this->_K, this->_vol, this->_alpha, this->_isCall, this->_n, this->_tol, &this->_termsUsed);
+
+          }
+
+
+          /**
+           * @brief The batch pricing method
+           * @details Prices the whole batch in a single loop over the pricing kernel avoiding
+           * the per-option virtual dispatch of the base class implementation
+           * @param St   Pointer to an array of prices of the underlying
+           * @param tau  Pointer to an array of times to maturity in years
+           * @param out  Pointer to a caller-provided buffer into which the prices are written
+           * @param n    The number of options in the batch
+           * @param r    Pointer to an array of risk-free rates. Optional and defaults to nullptr
+           * @param vol  Pointer to an array of volatilities. Optional and defaults to nullptr
+           * @returns    Void. The prices are written into the 'out' buffer
+           */
+          void priceBatch(const T* St, const T* tau, T* out, int n, const T* r = nullptr, const T* vol = nullptr) const override {
+
+            if ( n < 0 ) {
+              ERROR("The number of options can not be negative! (", n, " < 0)");
+            }
+
+            for (int i = 0; i < n; i++) {
+              out[i] = __GeneralCEVPrice<T>(St[i], tau[i], r != nullptr ? r[i] : this->_r, this->_K, vol != nullptr ? vol[i] : this->_vol, this->_alpha, this->_isCall, this->_n, this->_tol);
+            }
 
           }
 
@@ -329,7 +448,7 @@ namespace quantpy {
            */
           const T impliedVol(T Vt, T St, T tau, T lowerBound = (T)1e-6, T upperBound = (T)10.) const {
 
-            return __GeneralCEVImpliedVol<T>(Vt, St, tau, this->_r, this->_K, this->_alpha, this->_isCall, this->_n, lowerBound, upperBound);
+            return __GeneralCEVImpliedVol<T>(Vt, St, tau, this->_r, this->_K, this->_alpha, this->_isCall, this->_n, lowerBound, upperBound, this->_tol);
 
           }
 
@@ -0,0 +1,145 @@
+/**
+ * @file Portfolio_tests.cpp
+ * @brief Definition of tests for the portfolio pricing engine
+ * @details Compile in the main quantpy directory with:
+ * > g++ -std=c++17 -mavx -fopenmp -Wall quantpy/instruments/Portfolio/tests/Portfolio_tests.cpp -lm -o Portfolio_tests.o
+ * Run with:
+ * > ./Portfolio_tests.o
+ * @author Kasper Rantamäki
+ * @date 2026-08-29
+ */
+
+
+#include <cmath>
+#include <vector>
+
+#include "../Portfolio.hpp"
+#include "../../../cpp/testing.hpp"
+#include "../../../cpp/logging.hpp"
+
+
+#ifndef TEST_TOL
+  #define TEST_TOL 1e-6
+#endif
+
+
+namespace quantpy {
+
+  namespace instruments {
+
+    namespace Portfolio_tests {
+
+
+      // Test 1
+      bool test_price1() {
+
+        // A book of Black-Scholes calls and puts over a range of strikes
+        Portfolio::Portfolio<double> portfolio;
+
+        for (int i = 0; i < 10; i++) {
+          portfolio.addOption(Portfolio::BLACK_SCHOLES, 90. + 5. * i, 0.04, 0.2, i % 2 == 0);
+        }
+
+        std::vector<double> prices(portfolio.size());
+        portfolio.price(105., 1.5, prices.data());
+
+        bool passed = true;
+
+        for (int i = 0; i < 10; i++) {
+          EuropeanOption::BlackScholes<double> pricer(0.04, 90. + 5. * i, 0.2, i % 2 == 0);
+          double correctPrice = pricer(105., 1.5);
+
+          DEBUG("Found price: ", prices[i], " (correct ", correctPrice, ")");
+
+          // The tolerance accounts for the accuracy of the vectorized normal cdf approximation
+          passed = passed && ( fabs(correctPrice - prices[i]) < 1e-4 );
+        }
+
+        return passed;
+
+      }
+
+
+      // Test 2
+      bool test_price2() {
+
+        // A mixed book over all of the supported models
+        Portfolio::Portfolio<double> portfolio;
+
+        portfolio.addOption(Portfolio::BLACK_SCHOLES, 100., 0.04, 0.2, true);
+        portfolio.addOption(Portfolio::GENERAL_CEV, 100., 0.05, 0.2, true, 1.5);
+        portfolio.addOption(Portfolio::ABSOLUTE_CEV, 100., 0.04, 20., false);
+        portfolio.addOption(Portfolio::BLACK_SCHOLES, 110., 0.04, 0.25, false);
+
+        std::vector<double> prices(portfolio.size());
+        portfolio.price(100., 1., prices.data());
+
+        EuropeanOption::BlackScholes<double> blackScholes1(0.04, 100., 0.2, true);
+        EuropeanOption::GeneralCEV<double> generalCEV(0.05, 100., 0.2, 1.5, true);
+        EuropeanOption::AbsoluteCEV<double> absoluteCEV(0.04, 100., 20., false);
+        EuropeanOption::BlackScholes<double> blackScholes2(0.04, 110., 0.25, false);
+
+        bool passed = true;
+
+        passed = passed && ( fabs(blackScholes1(100., 1.) - prices[0]) < TEST_TOL );
+        passed = passed && ( fabs(generalCEV(100., 1.) - prices[1]) < TEST_TOL );
+        passed = passed && ( fabs(absoluteCEV(100., 1.) - prices[2]) < TEST_TOL );
+        passed = passed && ( fabs(blackScholes2(100., 1.) - prices[3]) < TEST_TOL );
+
+        DEBUG("Found prices: ", prices[0], ", ", prices[1], ", ", prices[2], " and ", prices[3]);
+
+        return passed;
+
+      }
+
+
+      // Test 3
+      bool test_price3() {
+
+        // The per-option array interface against the broadcasting one
+        Portfolio::Portfolio<double> portfolio;
+
+        for (int i = 0; i < 7; i++) {
+          portfolio.addOption(Portfolio::BLACK_SCHOLES, 100., 0.04, 0.2, true);
+        }
+
+        std::vector<double> Sts(portfolio.size(), 105.);
+        std::vector<double> taus(portfolio.size(), 1.5);
+
+        std::vector<double> arrayPrices(portfolio.size());
+        std::vector<double> broadcastPrices(portfolio.size());
+
+        portfolio.price(Sts.data(), taus.data(), arrayPrices.data());
+        portfolio.price(105., 1.5, broadcastPrices.data());
+
+        bool passed = true;
+
+        for (int i = 0; i < portfolio.size(); i++) {
+          passed = passed && ( arrayPrices[i] == broadcastPrices[i] );
+        }
+
+        return passed;
+
+      }
+
+
+    }
+
+  }
+
+}
+
+
+int main() {
+
+  quantpy::cpp::logging::verbosity(3);
+
+  quantpy::cpp::testing::TestSuite portfolioTests = quantpy::cpp::testing::TestSuite("Portfolio.hpp");
+
+  portfolioTests.addTest(quantpy::instruments::Portfolio_tests::test_price1);
+  portfolioTests.addTest(quantpy::instruments::Portfolio_tests::test_price2);
+  portfolioTests.addTest(quantpy::instruments::Portfolio_tests::test_price3);
+
+  return (int)portfolioTests.runTests();
+
+}
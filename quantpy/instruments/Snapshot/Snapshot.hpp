@@ -0,0 +1,478 @@
+/**
+ * @file Snapshot.hpp
+ * @brief Binary snapshot format for calibrated pricer state
+ * @details The calibrated parameters of a pricer are cheap to store but expensive to recompute: a
+ * GeneralCEV instrument for instance runs an implied volatility bisection on construction, which
+ * over a whole book turns a service restart into minutes of redundant work. The snapshot captures
+ * the parameter state of the closed form pricers and whole portfolios in a compact versioned
+ * binary file of fixed size records. Loading memory maps the file through futils::MappedFile and
+ * reconstructs the pricers straight from the stored parameters, so a warm restart costs a map and
+ * a linear pass over the records instead of a recalibration
+ * @author Kasper Rantamäki
+ * @date 2026-08-29
+ */
+
+#ifndef SNAPSHOT_HPP
+#define SNAPSHOT_HPP
+
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "../../cpp/logging.hpp"
+#include "../../cpp/futils.hpp"
+#include "../Portfolio/Portfolio.hpp"
+#include "../EuropeanOption/pricers/BlackScholes/BlackScholes.hpp"
+#include "../EuropeanOption/pricers/GeneralCEV/GeneralCEV.hpp"
+#include "../EuropeanOption/pricers/AbsoluteCEV/AbsoluteCEV.hpp"
+#include "../ZeroCouponBond/pricers/Vasicek/Vasicek.hpp"
+#include "../ZeroCouponBond/pricers/CIR/CIR.hpp"
+
+
+namespace quantpy {
+
+  namespace instruments {
+
+    namespace Snapshot {
+
+
+      /**
+       * @brief The magic bytes opening every snapshot file
+       */
+      constexpr char SNAPSHOT_MAGIC[8] = {'q', 'p', 's', 'n', 'a', 'p', '\0', '\0'};
+
+
+      /**
+       * @brief The version of the snapshot format written by this header
+       * @details Bumped whenever the header or record layout changes. Loading rejects files written
+       * with a different version rather than guessing at their layout
+       */
+      constexpr std::uint32_t SNAPSHOT_VERSION = 1;
+
+
+      /**
+       * @brief The pricer types a snapshot record can describe
+       * @details The option models share their values with the Portfolio::Model enum, so portfolio
+       * records map to the enum without translation
+       */
+      enum RecordModel : std::int32_t {
+        BLACK_SCHOLES = 0,
+        GENERAL_CEV   = 1,
+        ABSOLUTE_CEV  = 2,
+        VASICEK       = 3,
+        CIR           = 4
+      };
+
+
+      /**
+       * @brief The fixed size header opening every snapshot file
+       * @details The records follow the header back to back, so the file size is fully determined
+       * by the record count and a truncated or corrupted file is caught by a size check
+       */
+      struct SnapshotHeader {
+        char magic[8];          /**< The magic bytes identifying a snapshot file */
+        std::uint32_t version;  /**< The version of the snapshot format */
+        std::uint32_t count;    /**< The number of records in the file */
+      };
+
+
+      /**
+       * @brief A single fixed size snapshot record
+       * @details The parameter slots are read according to the model: the option models store
+       * (K, r, vol, alpha) and the short-rate models (theta, mu, vol, unused). The parameters are
+       * always stored as doubles so the file layout does not depend on the template type of the
+       * pricers that wrote it
+       */
+      struct SnapshotRecord {
+        std::int32_t model;   /**< The pricer type of the record as a RecordModel value */
+        std::int32_t isCall;  /**< Boolean flag telling if the option is a call or a put. Unused by the short-rate models */
+        double params[4];     /**< The model parameters in the slot order given by the model */
+      };
+
+
+      /**
+       * @brief Writes a snapshot file from the given records
+       * @param filepath  Path to the snapshot file. Overwritten if it exists
+       * @param records   The records to be written
+       * @returns         Void
+       */
+      inline void __writeSnapshot(const std::string& filepath, const std::vector<SnapshotRecord>& records) {
+
+        std::ofstream file(filepath, std::ios::binary | std::ios::trunc);
+
+        if ( !file ) {
+          ERROR("Couldn't open the file: ", filepath);
+        }
+
+        SnapshotHeader header;
+
+        std::memcpy(header.magic, SNAPSHOT_MAGIC, sizeof(SNAPSHOT_MAGIC));
+        header.version = SNAPSHOT_VERSION;
+        header.count   = (std::uint32_t)records.size();
+
+        file.write((const char*)&header, sizeof(SnapshotHeader));
+        file.write((const char*)records.data(), (std::streamsize)(records.size() * sizeof(SnapshotRecord)));
+
+        if ( !file ) {
+          ERROR("Failed writing the snapshot file: ", filepath);
+        }
+
+      }
+
+
+      /**
+       * @brief Memory mapped read-only view over a snapshot file
+       * @details Maps the file through futils::MappedFile and validates the magic bytes, the format
+       * version and that the file size matches the record count, after which the records are read
+       * in place from the mapping without copying. The records stay valid for the lifetime of the
+       * reader object
+       */
+      class SnapshotReader {
+
+        protected:
+
+          quantpy::cpp::futils::MappedFile _file;  /**< The memory mapped snapshot file */
+          const SnapshotRecord* _records;          /**< Pointer to the records within the mapping */
+          int _count;                              /**< The number of records in the snapshot */
+
+        public:
+
+          /**
+           * @brief Main constructor. Maps and validates the given snapshot file
+           * @param filepath  Path to the snapshot file
+           * @returns         Initialized SnapshotReader object
+           */
+          explicit SnapshotReader(const std::string& filepath) : _file(filepath) {
+
+            if ( this->_file.size() < sizeof(SnapshotHeader) ) {
+              ERROR("The file is too small to hold a snapshot header: ", filepath);
+            }
+
+            const SnapshotHeader* header = (const SnapshotHeader*)this->_file.data();
+
+            if ( std::memcmp(header->magic, SNAPSHOT_MAGIC, sizeof(SNAPSHOT_MAGIC)) != 0 ) {
+              ERROR("The file is not a snapshot file: ", filepath);
+            }
+
+            if ( header->version != SNAPSHOT_VERSION ) {
+              ERROR("Unsupported snapshot version! (", header->version, " != ", SNAPSHOT_VERSION, ")");
+            }
+
+            if ( this->_file.size() != sizeof(SnapshotHeader) + header->count * sizeof(SnapshotRecord) ) {
+              ERROR("The size of the snapshot file doesn't match its record count!");
+            }
+
+            this->_records = (const SnapshotRecord*)(this->_file.data() + sizeof(SnapshotHeader));
+            this->_count   = (int)header->count;
+
+          }
+
+
+          /**
+           * @brief Getter for the number of records in the snapshot
+           * @returns The number of records
+           */
+          int size() const { return this->_count; }
+
+
+          /**
+           * @brief Accessor for a record of the snapshot
+           * @param i  The index of the record
+           * @returns  Constant reference to the record within the mapping
+           */
+          const SnapshotRecord& record(int i) const {
+
+            if ( i < 0 || i >= this->_count ) {
+              ERROR("Record index out of bounds! (", i, ")");
+            }
+
+            return this->_records[i];
+
+          }
+
+      };
+
+
+      /**
+       * @brief Saves the parameter state of a whole portfolio into a snapshot file
+       * @tparam T         The template type of the portfolio. Should be some floating point number type
+       * @param portfolio  The portfolio to be saved
+       * @param filepath   Path to the snapshot file. Overwritten if it exists
+       * @returns          Void
+       */
+      template <typename T>
+      void save(const Portfolio::Portfolio<T>& portfolio, const std::string& filepath) {
+
+        std::vector<SnapshotRecord> records(portfolio.size());
+
+        for (int i = 0; i < portfolio.size(); i++) {
+
+          records[i].model     = (std::int32_t)portfolio.models()[i];
+          records[i].isCall    = (std::int32_t)portfolio.isCalls()[i];
+          records[i].params[0] = (double)portfolio.strikes()[i];
+          records[i].params[1] = (double)portfolio.rates()[i];
+          records[i].params[2] = (double)portfolio.vols()[i];
+          records[i].params[3] = (double)portfolio.alphas()[i];
+
+        }
+
+        __writeSnapshot(filepath, records);
+
+      }
+
+
+      /**
+       * @brief Restores a portfolio from a snapshot file
+       * @details The options are readded in their stored order, so the indices returned by the
+       * original addOption calls remain valid against the restored portfolio
+       * @tparam T        The template type of the portfolio. Should be some floating point number type
+       * @param filepath  Path to the snapshot file
+       * @returns         The restored Portfolio object
+       */
+      template <typename T>
+      Portfolio::Portfolio<T> loadPortfolio(const std::string& filepath) {
+
+        SnapshotReader reader = SnapshotReader(filepath);
+
+        Portfolio::Portfolio<T> portfolio;
+
+        for (int i = 0; i < reader.size(); i++) {
+
+          const SnapshotRecord& rec = reader.record(i);
+
+          if ( rec.model < BLACK_SCHOLES || rec.model > ABSOLUTE_CEV ) {
+            ERROR("The snapshot record is not a portfolio option! (model ", rec.model, ")");
+          }
+
+          portfolio.addOption((Portfolio::Model)rec.model, (T)rec.params[0], (T)rec.params[1],
+                              (T)rec.params[2], (bool)rec.isCall, (T)rec.params[3]);
+
+        }
+
+        return portfolio;
+
+      }
+
+
+      /**
+       * @brief Validates that a snapshot holds a single record of the wanted model and returns it
+       * @param reader  The reader over the snapshot file
+       * @param model   The expected pricer type of the record
+       * @returns       Constant reference to the record within the mapping
+       */
+      inline const SnapshotRecord& __singleRecord(const SnapshotReader& reader, RecordModel model) {
+
+        if ( reader.size() != 1 ) {
+          ERROR("Expected a single record snapshot! (found ", reader.size(), " records)");
+        }
+
+        if ( reader.record(0).model != model ) {
+          ERROR("The snapshot record doesn't hold the wanted pricer type! (", reader.record(0).model, " != ", (std::int32_t)model, ")");
+        }
+
+        return reader.record(0);
+
+      }
+
+
+      /**
+       * @brief Saves the parameter state of a Black-Scholes pricer into a snapshot file
+       * @tparam T        The template type of the pricer. Should be some floating point number type
+       * @param pricer    The pricer to be saved
+       * @param filepath  Path to the snapshot file. Overwritten if it exists
+       * @returns         Void
+       */
+      template <typename T>
+      void save(const EuropeanOption::BlackScholes<T>& pricer, const std::string& filepath) {
+
+        SnapshotRecord rec = { BLACK_SCHOLES, (std::int32_t)pricer.isCall(),
+                               { (double)pricer.strike(), (double)pricer.r(), (double)pricer.vol(), 1. } };
+
+        __writeSnapshot(filepath, { rec });
+
+      }
+
+
+      /**
+       * @brief Restores a Black-Scholes pricer from a snapshot file
+       * @tparam T        The template type of the pricer. Should be some floating point number type
+       * @param filepath  Path to the snapshot file
+       * @returns         The restored BlackScholes object
+       */
+      template <typename T>
+      EuropeanOption::BlackScholes<T> loadBlackScholes(const std::string& filepath) {
+
+        SnapshotReader reader = SnapshotReader(filepath);
+
+        const SnapshotRecord& rec = __singleRecord(reader, BLACK_SCHOLES);
+
+        return EuropeanOption::BlackScholes<T>((T)rec.params[1], (T)rec.params[0], (T)rec.params[2], (bool)rec.isCall);
+
+      }
+
+
+      /**
+       * @brief Saves the parameter state of a general CEV pricer into a snapshot file
+       * @details The volatility stored is the current one, so a pricer calibrated through the
+       * implied volatility constructor restores without rerunning the bisection
+       * @tparam T        The template type of the pricer. Should be some floating point number type
+       * @param pricer    The pricer to be saved
+       * @param filepath  Path to the snapshot file. Overwritten if it exists
+       * @returns         Void
+       */
+      template <typename T>
+      void save(const EuropeanOption::GeneralCEV<T>& pricer, const std::string& filepath) {
+
+        SnapshotRecord rec = { GENERAL_CEV, (std::int32_t)pricer.isCall(),
+                               { (double)pricer.strike(), (double)pricer.r(), (double)pricer.vol(), (double)pricer.alpha() } };
+
+        __writeSnapshot(filepath, { rec });
+
+      }
+
+
+      /**
+       * @brief Restores a general CEV pricer from a snapshot file
+       * @details The pricer is rebuilt through the direct volatility constructor, so the load does
+       * not rerun the implied volatility bisection. The series truncation parameters are not part
+       * of the snapshot and fall back to the constructor defaults
+       * @tparam T        The template type of the pricer. Should be some floating point number type
+       * @param filepath  Path to the snapshot file
+       * @returns         The restored GeneralCEV object
+       */
+      template <typename T>
+      EuropeanOption::GeneralCEV<T> loadGeneralCEV(const std::string& filepath) {
+
+        SnapshotReader reader = SnapshotReader(filepath);
+
+        const SnapshotRecord& rec = __singleRecord(reader, GENERAL_CEV);
+
+        return EuropeanOption::GeneralCEV<T>((T)rec.params[1], (T)rec.params[0], (T)rec.params[2],
+                                             (T)rec.params[3], (bool)rec.isCall);
+
+      }
+
+
+      /**
+       * @brief Saves the parameter state of an absolute CEV pricer into a snapshot file
+       * @tparam T        The template type of the pricer. Should be some floating point number type
+       * @param pricer    The pricer to be saved
+       * @param filepath  Path to the snapshot file. Overwritten if it exists
+       * @returns         Void
+       */
+      template <typename T>
+      void save(const EuropeanOption::AbsoluteCEV<T>& pricer, const std::string& filepath) {
+
+        SnapshotRecord rec = { ABSOLUTE_CEV, (std::int32_t)pricer.isCall(),
+                               { (double)pricer.strike(), (double)pricer.r(), (double)pricer.vol(), 0. } };
+
+        __writeSnapshot(filepath, { rec });
+
+      }
+
+
+      /**
+       * @brief Restores an absolute CEV pricer from a snapshot file
+       * @tparam T        The template type of the pricer. Should be some floating point number type
+       * @param filepath  Path to the snapshot file
+       * @returns         The restored AbsoluteCEV object
+       */
+      template <typename T>
+      EuropeanOption::AbsoluteCEV<T> loadAbsoluteCEV(const std::string& filepath) {
+
+        SnapshotReader reader = SnapshotReader(filepath);
+
+        const SnapshotRecord& rec = __singleRecord(reader, ABSOLUTE_CEV);
+
+        return EuropeanOption::AbsoluteCEV<T>((T)rec.params[1], (T)rec.params[0], (T)rec.params[2], (bool)rec.isCall);
+
+      }
+
+
+      /**
+       * @brief Saves the parameter state of a Vasicek pricer into a snapshot file
+       * @details The parameters stored are the current ones, so a pricer calibrated against an
+       * observed price curve restores without rerunning the least squares fit
+       * @tparam T        The template type of the pricer. Should be some floating point number type
+       * @param pricer    The pricer to be saved
+       * @param filepath  Path to the snapshot file. Overwritten if it exists
+       * @returns         Void
+       */
+      template <typename T>
+      void save(const ZeroCouponBond::Vasicek<T>& pricer, const std::string& filepath) {
+
+        SnapshotRecord rec = { VASICEK, 0,
+                               { (double)pricer.theta(), (double)pricer.mu(), (double)pricer.vol(), 0. } };
+
+        __writeSnapshot(filepath, { rec });
+
+      }
+
+
+      /**
+       * @brief Restores a Vasicek pricer from a snapshot file
+       * @tparam T        The template type of the pricer. Should be some floating point number type
+       * @param filepath  Path to the snapshot file
+       * @returns         The restored Vasicek object
+       */
+      template <typename T>
+      ZeroCouponBond::Vasicek<T> loadVasicek(const std::string& filepath) {
+
+        SnapshotReader reader = SnapshotReader(filepath);
+
+        const SnapshotRecord& rec = __singleRecord(reader, VASICEK);
+
+        return ZeroCouponBond::Vasicek<T>((T)rec.params[0], (T)rec.params[1], (T)rec.params[2]);
+
+      }
+
+
+      /**
+       * @brief Saves the parameter state of a CIR pricer into a snapshot file
+       * @details The parameters stored are the current ones, so a pricer calibrated against an
+       * observed price curve restores without rerunning the least squares fit
+       * @tparam T        The template type of the pricer. Should be some floating point number type
+       * @param pricer    The pricer to be saved
+       * @param filepath  Path to the snapshot file. Overwritten if it exists
+       * @returns         Void
+       */
+      template <typename T>
+      void save(const ZeroCouponBond::CIR<T>& pricer, const std::string& filepath) {
+
+        SnapshotRecord rec = { CIR, 0,
+                               { (double)pricer.theta(), (double)pricer.mu(), (double)pricer.vol(), 0. } };
+
+        __writeSnapshot(filepath, { rec });
+
+      }
+
+
+      /**
+       * @brief Restores a CIR pricer from a snapshot file
+       * @tparam T        The template type of the pricer. Should be some floating point number type
+       * @param filepath  Path to the snapshot file
+       * @returns         The restored CIR object
+       */
+      template <typename T>
+      ZeroCouponBond::CIR<T> loadCIR(const std::string& filepath) {
+
+        SnapshotReader reader = SnapshotReader(filepath);
+
+        const SnapshotRecord& rec = __singleRecord(reader, CIR);
+
+        return ZeroCouponBond::CIR<T>((T)rec.params[0], (T)rec.params[1], (T)rec.params[2]);
+
+      }
+
+
+    }
+
+  }
+
+}
+
+
+#endif
@@ -0,0 +1,209 @@
+/**
+ * @file Snapshot_tests.cpp
+ * @brief Definition of tests for the binary pricer snapshot format
+ * @details Compile in the main quantpy directory with:
+ * > g++ -std=c++17 -mavx -fopenmp -Wall quantpy/instruments/Snapshot/tests/Snapshot_tests.cpp -lm -o Snapshot_tests.o
+ * Run with:
+ * > ./Snapshot_tests.o
+ * @author Kasper Rantamäki
+ * @date 2026-08-29
+ */
+
+
+#include <cmath>
+#include <string>
+#include <vector>
+
+#include "../Snapshot.hpp"
+#include "../../../cpp/testing.hpp"
+#include "../../../cpp/logging.hpp"
+
+
+#ifndef TEST_TOL
+  #define TEST_TOL 1e-12
+#endif
+
+
+namespace quantpy {
+
+  namespace instruments {
+
+    namespace Snapshot_tests {
+
+
+      // Test 1
+      bool test_portfolio1() {
+
+        // A mixed book should round-trip with its parameters and option order intact
+        Portfolio::Portfolio<double> portfolio;
+
+        portfolio.addOption(Portfolio::BLACK_SCHOLES, 100., 0.04, 0.2, true);
+        portfolio.addOption(Portfolio::GENERAL_CEV, 100., 0.05, 0.2, true, 1.5);
+        portfolio.addOption(Portfolio::ABSOLUTE_CEV, 100., 0.04, 20., false);
+        portfolio.addOption(Portfolio::BLACK_SCHOLES, 110., 0.04, 0.25, false);
+
+        std::string filepath = "/tmp/snapshot_portfolio_test.qps";
+        Snapshot::save(portfolio, filepath);
+
+        Portfolio::Portfolio<double> loaded = Snapshot::loadPortfolio<double>(filepath);
+
+        bool passed = ( loaded.size() == portfolio.size() );
+
+        for (int i = 0; i < portfolio.size(); i++) {
+          passed = passed && ( loaded.models()[i] == portfolio.models()[i] );
+          passed = passed && ( loaded.strikes()[i] == portfolio.strikes()[i] );
+          passed = passed && ( loaded.rates()[i] == portfolio.rates()[i] );
+          passed = passed && ( loaded.vols()[i] == portfolio.vols()[i] );
+          passed = passed && ( loaded.alphas()[i] == portfolio.alphas()[i] );
+          passed = passed && ( loaded.isCalls()[i] == portfolio.isCalls()[i] );
+        }
+
+        return passed;
+
+      }
+
+
+      // Test 2
+      bool test_portfolio2() {
+
+        // The restored book should price identically to the original one
+        Portfolio::Portfolio<double> portfolio;
+
+        for (int i = 0; i < 10; i++) {
+          portfolio.addOption(Portfolio::BLACK_SCHOLES, 90. + 5. * i, 0.04, 0.2, i % 2 == 0);
+        }
+
+        std::string filepath = "/tmp/snapshot_portfolio_test.qps";
+        Snapshot::save(portfolio, filepath);
+
+        Portfolio::Portfolio<double> loaded = Snapshot::loadPortfolio<double>(filepath);
+
+        std::vector<double> prices(portfolio.size());
+        std::vector<double> loadedPrices(loaded.size());
+
+        portfolio.price(105., 1.5, prices.data());
+        loaded.price(105., 1.5, loadedPrices.data());
+
+        bool passed = true;
+
+        for (int i = 0; i < portfolio.size(); i++) {
+          DEBUG("Found price: ", loadedPrices[i], " (correct ", prices[i], ")");
+          passed = passed && ( loadedPrices[i] == prices[i] );
+        }
+
+        return passed;
+
+      }
+
+
+      // Test 3
+      bool test_generalCEV1() {
+
+        // A pricer calibrated through the implied volatility constructor should restore with the
+        // calibrated volatility and price identically without rerunning the bisection
+        EuropeanOption::GeneralCEV<double> pricer(10., 105., 1.5, 0.05, 100., 1.5);
+
+        std::string filepath = "/tmp/snapshot_general_cev_test.qps";
+        Snapshot::save(pricer, filepath);
+
+        EuropeanOption::GeneralCEV<double> loaded = Snapshot::loadGeneralCEV<double>(filepath);
+
+        DEBUG("Found volatility: ", loaded.vol(), " (correct ", pricer.vol(), ")");
+
+        return ( loaded.vol() == pricer.vol() ) && ( loaded.alpha() == pricer.alpha() ) &&
+               ( fabs(loaded(105., 1.5) - pricer(105., 1.5)) < TEST_TOL );
+
+      }
+
+
+      // Test 4
+      bool test_blackScholes1() {
+
+        EuropeanOption::BlackScholes<double> pricer(0.04, 110., 0.25, false);
+
+        std::string filepath = "/tmp/snapshot_black_scholes_test.qps";
+        Snapshot::save(pricer, filepath);
+
+        EuropeanOption::BlackScholes<double> loaded = Snapshot::loadBlackScholes<double>(filepath);
+
+        return ( loaded.r() == pricer.r() ) && ( loaded.strike() == pricer.strike() ) &&
+               ( loaded.vol() == pricer.vol() ) && ( loaded.isCall() == pricer.isCall() ) &&
+               ( loaded(105., 1.5) == pricer(105., 1.5) );
+
+      }
+
+
+      // Test 5
+      bool test_shortRate1() {
+
+        // The short-rate pricers store (theta, mu, vol) and should round-trip exactly
+        ZeroCouponBond::Vasicek<double> vasicek(0.15, 0.04, 0.01);
+        ZeroCouponBond::CIR<double> cir(0.2, 0.05, 0.05);
+
+        std::string vasicekPath = "/tmp/snapshot_vasicek_test.qps";
+        std::string cirPath = "/tmp/snapshot_cir_test.qps";
+
+        Snapshot::save(vasicek, vasicekPath);
+        Snapshot::save(cir, cirPath);
+
+        ZeroCouponBond::Vasicek<double> loadedVasicek = Snapshot::loadVasicek<double>(vasicekPath);
+        ZeroCouponBond::CIR<double> loadedCir = Snapshot::loadCIR<double>(cirPath);
+
+        bool passed = ( loadedVasicek.theta() == vasicek.theta() ) && ( loadedVasicek.mu() == vasicek.mu() ) &&
+                      ( loadedVasicek.vol() == vasicek.vol() );
+
+        passed = passed && ( loadedCir.theta() == cir.theta() ) && ( loadedCir.mu() == cir.mu() ) &&
+                 ( loadedCir.vol() == cir.vol() );
+
+        return passed && ( loadedVasicek(0.03, 2.) == vasicek(0.03, 2.) ) && ( loadedCir(0.03, 2.) == cir(0.03, 2.) );
+
+      }
+
+
+      // Test 6
+      bool test_reader1() {
+
+        // The reader should expose the raw records of the mapped file
+        EuropeanOption::GeneralCEV<double> pricer(0.05, 100., 0.2, 1.5, true);
+
+        std::string filepath = "/tmp/snapshot_reader_test.qps";
+        Snapshot::save(pricer, filepath);
+
+        Snapshot::SnapshotReader reader = Snapshot::SnapshotReader(filepath);
+
+        bool passed = ( reader.size() == 1 );
+
+        const Snapshot::SnapshotRecord& rec = reader.record(0);
+
+        passed = passed && ( rec.model == Snapshot::GENERAL_CEV ) && ( rec.isCall == 1 );
+        passed = passed && ( rec.params[0] == 100. ) && ( rec.params[1] == 0.05 );
+        passed = passed && ( rec.params[2] == 0.2 ) && ( rec.params[3] == 1.5 );
+
+        return passed;
+
+      }
+
+
+    }
+
+  }
+
+}
+
+
+int main() {
+
+  quantpy::cpp::logging::verbosity(3);
+
+  quantpy::cpp::testing::TestSuite snapshotTests = quantpy::cpp::testing::TestSuite("Snapshot.hpp");
+
+  snapshotTests.addTest(quantpy::instruments::Snapshot_tests::test_portfolio1);
+  snapshotTests.addTest(quantpy::instruments::Snapshot_tests::test_portfolio2);
+  snapshotTests.addTest(quantpy::instruments::Snapshot_tests::test_generalCEV1);
+  snapshotTests.addTest(quantpy::instruments::Snapshot_tests::test_blackScholes1);
+  snapshotTests.addTest(quantpy::instruments::Snapshot_tests::test_shortRate1);
+  snapshotTests.addTest(quantpy::instruments::Snapshot_tests::test_reader1);
+
+  return (int)snapshotTests.runTests();
+
+}
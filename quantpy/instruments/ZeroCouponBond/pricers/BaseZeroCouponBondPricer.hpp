@@ -9,6 +9,10 @@
 #define BASE_ZERO_COUPON_BOND_PRICER_HPP
 
 
+#include <cmath>
+#include <vector>
+
+#include "../../../cpp/logging.hpp"
 #include "../../../math/special/differentiation.hpp"
 
 
@@ -26,6 +30,39 @@ namespace quantpy {
 
           T _vol;  /**< The volatility */
 
+          mutable std::vector<T> _cachedTau;     /**< The maturity grid the coefficient cache was built for */
+          mutable std::vector<T> _cachedA;       /**< The cached \f$ A \f$ coefficients, one per maturity */
+          mutable std::vector<T> _cachedB;       /**< The cached \f$ B \f$ coefficients, one per maturity */
+          mutable std::vector<T> _cachedParams;  /**< The parameter values the coefficient cache was built with */
+
+
+          /**
+           * @brief Virtual function for the affine term structure coefficients. Needs to be overriden
+           * @details The affine short-rate models price the zero-coupon bond as
+           * \f$ P(r_t, \tau) = A(\tau) e^{-B(\tau) r_t} \f$. The default coefficients reproduce the
+           * zero price returned by the base pricing method
+           * @param tau  The time to maturity in years
+           * @param A    Reference into which the coefficient \f$ A \f$ is written
+           * @param B    Reference into which the coefficient \f$ B \f$ is written
+           * @returns    Void
+           */
+          virtual void _termCoefficients(T tau, T& A, T& B) const {
+
+            A = (T)0.;
+            B = (T)0.;
+
+          }
+
+
+          /**
+           * @brief Virtual function for the model parameters the coefficients depend on
+           * @details Used to detect stale caches: the cached coefficients are rebuilt whenever the
+           * values returned here differ from the ones the cache was built with, so parameter updates
+           * through the setters invalidate the cache on the next pricing call
+           * @returns The current parameter values
+           */
+          virtual std::vector<T> _parameters() const { return { this->_vol }; }
+
         public:
 
           /**
@@ -56,6 +93,53 @@ namespace quantpy {
           const T& vol() const { return this->_vol; }
 
 
+          /**
+           * @brief Prices the bond over a whole maturity grid for a single rate scenario
+           * @details For the affine short-rate models the maturity-dependent work sits entirely in the
+           * coefficients \f$ A(\tau) \f$ and \f$ B(\tau) \f$, which cost several exp/pow calls each but
+           * do not depend on the prevailing rate. The coefficients are therefore computed once per
+           * parameter set and maturity grid and cached, after which each scenario revaluation reduces
+           * to one exp per maturity in a tight sweep over the cached vectors. The cache is rebuilt
+           * automatically when the grid or the model parameters change
+           * @param rt   The prevailing (continuously compounded) interest rate of the scenario
+           * @param tau  Pointer to an array of times to maturity in years
+           * @param out  Pointer to a caller-provided buffer into which the prices are written
+           * @param n    The number of maturities in the grid
+           * @returns    Void. The prices are written into the 'out' buffer
+           */
+          void priceScenario(T rt, const T* tau, T* out, int n) const {
+
+            if ( n < 0 ) {
+              ERROR("The number of maturities can not be negative! (", n, " < 0)");
+            }
+
+            bool cacheValid = ( (int)this->_cachedTau.size() == n ) && ( this->_cachedParams == this->_parameters() );
+
+            for (int i = 0; cacheValid && i < n; i++) {
+              cacheValid = this->_cachedTau[i] == tau[i];
+            }
+
+            if ( !cacheValid ) {
+
+              this->_cachedTau.assign(tau, tau + n);
+              this->_cachedA.resize(n);
+              this->_cachedB.resize(n);
+
+              for (int i = 0; i < n; i++) {
+                this->_termCoefficients(tau[i], this->_cachedA[i], this->_cachedB[i]);
+              }
+
+              this->_cachedParams = this->_parameters();
+
+            }
+
+            for (int i = 0; i < n; i++) {
+              out[i] = this->_cachedA[i] * exp(-this->_cachedB[i] * rt);
+            }
+
+          }
+
+
           /**
            * @brief Virtual function for calculating the interest rate delta via finite differences
            * @param rt   The prevailing (continuously compounded) interest rate
@@ -0,0 +1,183 @@
+/**
+ * @file CIR_tests.cpp
+ * @brief Definition of tests for the Cox-Ingersoll-Ross zero-coupon bond pricer
+ * @details Compile in the main quantpy directory with:
+ * > g++ -std=c++17 -mavx -fopenmp -Wall quantpy/instruments/ZeroCouponBond/pricers/CIR/tests/CIR_tests.cpp -lm -o CIR_tests.o
+ * Run with:
+ * > ./CIR_tests.o
+ * @author Kasper Rantamäki
+ * @date 2026-08-29
+ */
+
+#include "../CIR.hpp"
+#include "../../../../../cpp/testing.hpp"
+#include "../../../../../cpp/logging.hpp"
+
+
+#ifndef TEST_TOL
+  #define TEST_TOL 1e-10
+#endif
+
+
+namespace quantpy {
+
+  namespace instruments {
+
+    namespace ZeroCouponBond {
+
+      namespace CIR_tests {
+
+
+        // Test 1
+        bool test_price1() {
+
+          CIR pricer = CIR<double>(0.5, 0.04, 0.1);
+
+          // The price should lie below par and decrease with the time to maturity
+          bool passed = true;
+          double previousPrice = 1.;
+
+          for (int i = 1; i <= 10; i++) {
+
+            double foundPrice = pricer(0.03, (double)i);
+
+            DEBUG("Found price: ", foundPrice);
+
+            passed = passed && ( foundPrice > 0. ) && ( foundPrice < previousPrice );
+            previousPrice = foundPrice;
+
+          }
+
+          return passed;
+
+        }
+
+
+        // Test 2
+        bool test_price2() {
+
+          // As the volatility vanishes the CIR price should approach the deterministic
+          // mean-reverting discount bond. The convergence is quadratic in the volatility
+          CIR pricer = CIR<double>(0.5, 0.04, 1e-3);
+
+          double rt  = 0.03;
+          double tau = 2.;
+
+          double B = (1. - exp(-0.5 * tau)) / 0.5;
+          double correctPrice = exp(-0.04 * (tau - B) - B * rt);
+          double foundPrice   = pricer(rt, tau);
+
+          DEBUG("Found price: ", foundPrice, " (correct: ", correctPrice, ")");
+
+          return fabs(foundPrice - correctPrice) < 1e-6;
+
+        }
+
+
+        // Test 3
+        bool test_priceScenario1() {
+
+          CIR pricer = CIR<double>(0.5, 0.04, 0.1);
+
+          double maturities[5] = { 0.5, 1., 2., 5., 10. };
+          double foundPrices[5];
+
+          // The bulk pricing over the cached coefficients should match the scalar pricing exactly
+          bool passed = true;
+
+          for (double rt : { 0.01, 0.03, 0.05 }) {
+
+            pricer.priceScenario(rt, maturities, foundPrices, 5);
+
+            for (int i = 0; i < 5; i++) {
+              passed = passed && ( fabs(foundPrices[i] - pricer(rt, maturities[i])) < TEST_TOL );
+            }
+
+          }
+
+          return passed;
+
+        }
+
+
+        // Test 4
+        bool test_priceScenario2() {
+
+          CIR pricer = CIR<double>(0.5, 0.04, 0.1);
+
+          double maturities[5] = { 0.5, 1., 2., 5., 10. };
+          double foundPrices[5];
+
+          // Build the coefficient cache and then change the parameters through the setters
+          pricer.priceScenario(0.03, maturities, foundPrices, 5);
+
+          pricer.mu()  = 0.05;
+          pricer.vol() = 0.12;
+
+          pricer.priceScenario(0.03, maturities, foundPrices, 5);
+
+          // The cache should have been invalidated and the prices match the new parameters
+          bool passed = true;
+
+          for (int i = 0; i < 5; i++) {
+            passed = passed && ( fabs(foundPrices[i] - pricer(0.03, maturities[i])) < TEST_TOL );
+          }
+
+          return passed;
+
+        }
+
+
+        // Test 5
+        bool test_calibrate1() {
+
+          // Generate an observed curve from known parameters and calibrate from a perturbed guess
+          CIR truePricer = CIR<double>(0.5, 0.04, 0.1);
+
+          double maturities[8] = { 0.25, 0.5, 1., 2., 3., 5., 7., 10. };
+          double observedPrices[8];
+
+          truePricer.priceScenario(0.03, maturities, observedPrices, 8);
+
+          CIR calibratedPricer = CIR<double>(0.3, 0.03, 0.15);
+          calibratedPricer.calibrate(0.03, maturities, observedPrices, 8);
+
+          DEBUG("Found parameters: ", calibratedPricer.theta(), ", ", calibratedPricer.mu(), ", ", calibratedPricer.vol());
+
+          // The calibration should reproduce the observed prices even if the parameters are not
+          // perfectly identified from price data alone
+          bool passed = true;
+
+          for (int i = 0; i < 8; i++) {
+            passed = passed && ( fabs(calibratedPricer(0.03, maturities[i]) - observedPrices[i]) < 1e-8 );
+          }
+
+          return passed;
+
+        }
+
+
+      }
+
+    }
+
+  }
+
+}
+
+
+int main() {
+
+  quantpy::cpp::logging::verbosity(3);
+
+  quantpy::cpp::testing::TestSuite cirTests = quantpy::cpp::testing::TestSuite("CIR.hpp");
+
+  cirTests.addTest(quantpy::instruments::ZeroCouponBond::CIR_tests::test_price1);
+  cirTests.addTest(quantpy::instruments::ZeroCouponBond::CIR_tests::test_price2);
+  cirTests.addTest(quantpy::instruments::ZeroCouponBond::CIR_tests::test_priceScenario1);
+  cirTests.addTest(quantpy::instruments::ZeroCouponBond::CIR_tests::test_priceScenario2);
+  cirTests.addTest(quantpy::instruments::ZeroCouponBond::CIR_tests::test_calibrate1);
+
+  return (int)cirTests.runTests();
+
+}
@@ -23,6 +23,10 @@
 
 
 #include <cmath>
+#include <vector>
+
+#include "../BaseZeroCouponBondPricer.hpp"
+#include "../../../../math/optimization/leastSquares.hpp"
 
 
 namespace quantpy {
@@ -85,11 +89,33 @@ namespace quantpy {
 
 
       /**
-       * @todo Implement the estimator. This requires nonlinear least-squares which is not yet implemented
+       * @brief Calibrates the Vasicek parameters to an observed zero-coupon price curve. To be called by 'Vasicek' class
+       * @details Minimizes the sum of squared pricing errors over the observed curve with the
+       * Levenberg-Marquardt method, using the passed parameter values as the initial guess. The
+       * residuals are evaluated in parallel over the observation grid
+       * @tparam T     The template type. Should be some floating point number type
+       * @param rt     The prevailing (continuously compounded) interest rate
+       * @param tau    Pointer to an array of observed times to maturity in years
+       * @param price  Pointer to an array of observed zero-coupon bond prices
+       * @param n      The number of observations
+       * @param theta  Reference to the rate of mean reversion. Used as the initial guess and overwritten with the calibrated value
+       * @param mu     Reference to the long-term mean. Used as the initial guess and overwritten with the calibrated value
+       * @param vol    Reference to the volatility. Used as the initial guess and overwritten with the calibrated value
+       * @returns      Void. The calibrated parameters are written into the passed references
        */
       template <typename T>
-      void __VasicekYieldCurveCalibration() {
-        return void
+      void __VasicekYieldCurveCalibration(T rt, const T* tau, const T* price, int n, T& theta, T& mu, T& vol) {
+
+        auto residual = [=](const std::vector<T>& params, int i) {
+          return __VasicekPrice<T>(rt, tau[i], params[0], params[1], params[2]) - price[i];
+        };
+
+        std::vector<T> params = quantpy::math::optimization::leastSquares::levenbergMarquardt<T>(residual, n, { theta, mu, vol });
+
+        theta = params[0];
+        mu    = params[1];
+        vol   = params[2];
+
       }
 
 
@@ -105,6 +131,28 @@ namespace quantpy {
           T _theta;  /**< The rate of mean reversion */
           T _mu;     /**< The long-term mean */
 
+
+          /**
+           * @brief The affine term structure coefficients of the Vasicek model
+           * @param tau  The time to maturity in years
+           * @param A    Reference into which the coefficient \f$ A \f$ is written
+           * @param B    Reference into which the coefficient \f$ B \f$ is written
+           * @returns    Void
+           */
+          virtual void _termCoefficients(T tau, T& A, T& B) const override {
+
+            A = __VasicekA(tau, this->_theta, this->_mu, this->_vol);
+            B = __VasicekB(tau, this->_theta);
+
+          }
+
+
+          /**
+           * @brief The model parameters the coefficients depend on
+           * @returns The current parameter values
+           */
+          virtual std::vector<T> _parameters() const override { return { this->_theta, this->_mu, this->_vol }; }
+
         public:
 
           /**
@@ -148,6 +196,23 @@ namespace quantpy {
           }
 
 
+          /**
+           * @brief Calibrates the model parameters to an observed zero-coupon price curve
+           * @details The current parameter values are used as the initial guess, so a rough manual
+           * guess or yesterday's calibration makes a good starting point
+           * @param rt     The prevailing (continuously compounded) interest rate
+           * @param tau    Pointer to an array of observed times to maturity in years
+           * @param price  Pointer to an array of observed zero-coupon bond prices
+           * @param n      The number of observations
+           * @returns      Void. The calibrated parameters are stored in the object
+           */
+          void calibrate(T rt, const T* tau, const T* price, int n) {
+
+            __VasicekYieldCurveCalibration<T>(rt, tau, price, n, this->_theta, this->_mu, this->_vol);
+
+          }
+
+
           /**
            * @brief Setter for the rate of mean reversion
            * @returns The rate of mean reversion
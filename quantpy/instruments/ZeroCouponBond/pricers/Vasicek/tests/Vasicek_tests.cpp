@@ -0,0 +1,161 @@
+/**
+ * @file Vasicek_tests.cpp
+ * @brief Definition of tests for the Vasicek zero-coupon bond pricer
+ * @details Compile in the main quantpy directory with:
+ * > g++ -std=c++17 -mavx -fopenmp -Wall quantpy/instruments/ZeroCouponBond/pricers/Vasicek/tests/Vasicek_tests.cpp -lm -o Vasicek_tests.o
+ * Run with:
+ * > ./Vasicek_tests.o
+ * @author Kasper Rantamäki
+ * @date 2026-08-29
+ */
+
+#include "../Vasicek.hpp"
+#include "../../../../../cpp/testing.hpp"
+#include "../../../../../cpp/logging.hpp"
+
+
+#ifndef TEST_TOL
+  #define TEST_TOL 1e-10
+#endif
+
+
+namespace quantpy {
+
+  namespace instruments {
+
+    namespace ZeroCouponBond {
+
+      namespace Vasicek_tests {
+
+
+        // Test 1
+        bool test_price1() {
+
+          Vasicek pricer = Vasicek<double>(0.5, 0.04, 0.01);
+
+          // The price should lie below par and decrease with the time to maturity
+          bool passed = true;
+          double previousPrice = 1.;
+
+          for (int i = 1; i <= 10; i++) {
+
+            double foundPrice = pricer(0.03, (double)i);
+
+            DEBUG("Found price: ", foundPrice);
+
+            passed = passed && ( foundPrice > 0. ) && ( foundPrice < previousPrice );
+            previousPrice = foundPrice;
+
+          }
+
+          return passed;
+
+        }
+
+
+        // Test 2
+        bool test_priceScenario1() {
+
+          Vasicek pricer = Vasicek<double>(0.5, 0.04, 0.01);
+
+          double maturities[5] = { 0.5, 1., 2., 5., 10. };
+          double foundPrices[5];
+
+          // The bulk pricing over the cached coefficients should match the scalar pricing exactly
+          bool passed = true;
+
+          for (double rt : { 0.01, 0.03, 0.05 }) {
+
+            pricer.priceScenario(rt, maturities, foundPrices, 5);
+
+            for (int i = 0; i < 5; i++) {
+              passed = passed && ( fabs(foundPrices[i] - pricer(rt, maturities[i])) < TEST_TOL );
+            }
+
+          }
+
+          return passed;
+
+        }
+
+
+        // Test 3
+        bool test_priceScenario2() {
+
+          Vasicek pricer = Vasicek<double>(0.5, 0.04, 0.01);
+
+          double maturities[5] = { 0.5, 1., 2., 5., 10. };
+          double foundPrices[5];
+
+          // Build the coefficient cache and then change the parameters through the setters
+          pricer.priceScenario(0.03, maturities, foundPrices, 5);
+
+          pricer.theta() = 0.8;
+          pricer.vol()   = 0.015;
+
+          pricer.priceScenario(0.03, maturities, foundPrices, 5);
+
+          // The cache should have been invalidated and the prices match the new parameters
+          bool passed = true;
+
+          for (int i = 0; i < 5; i++) {
+            passed = passed && ( fabs(foundPrices[i] - pricer(0.03, maturities[i])) < TEST_TOL );
+          }
+
+          return passed;
+
+        }
+
+
+        // Test 4
+        bool test_calibrate1() {
+
+          // Generate an observed curve from known parameters and calibrate from a perturbed guess
+          Vasicek truePricer = Vasicek<double>(0.5, 0.04, 0.01);
+
+          double maturities[8] = { 0.25, 0.5, 1., 2., 3., 5., 7., 10. };
+          double observedPrices[8];
+
+          truePricer.priceScenario(0.03, maturities, observedPrices, 8);
+
+          Vasicek calibratedPricer = Vasicek<double>(0.3, 0.03, 0.02);
+          calibratedPricer.calibrate(0.03, maturities, observedPrices, 8);
+
+          DEBUG("Found parameters: ", calibratedPricer.theta(), ", ", calibratedPricer.mu(), ", ", calibratedPricer.vol());
+
+          // The calibration should reproduce the observed prices even if the parameters are not
+          // perfectly identified from price data alone
+          bool passed = true;
+
+          for (int i = 0; i < 8; i++) {
+            passed = passed && ( fabs(calibratedPricer(0.03, maturities[i]) - observedPrices[i]) < 1e-8 );
+          }
+
+          return passed;
+
+        }
+
+
+      }
+
+    }
+
+  }
+
+}
+
+
+int main() {
+
+  quantpy::cpp::logging::verbosity(3);
+
+  quantpy::cpp::testing::TestSuite vasicekTests = quantpy::cpp::testing::TestSuite("Vasicek.hpp");
+
+  vasicekTests.addTest(quantpy::instruments::ZeroCouponBond::Vasicek_tests::test_price1);
+  vasicekTests.addTest(quantpy::instruments::ZeroCouponBond::Vasicek_tests::test_priceScenario1);
+  vasicekTests.addTest(quantpy::instruments::ZeroCouponBond::Vasicek_tests::test_priceScenario2);
+  vasicekTests.addTest(quantpy::instruments::ZeroCouponBond::Vasicek_tests::test_calibrate1);
+
+  return (int)vasicekTests.runTests();
+
+}
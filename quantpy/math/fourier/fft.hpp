@@ -0,0 +1,110 @@
+/**
+ * @file fft.hpp
+ * @brief Implementation of the radix-2 fast Fourier transform
+ * @author Kasper Rantamäki
+ * @date 2026-08-29
+ */
+
+#ifndef FFT_HPP
+#define FFT_HPP
+
+
+#include <cmath>
+#include <complex>
+
+#include "../../cpp/logging.hpp"
+
+
+#ifndef PI
+  #define PI 3.141592653589793
+#endif
+
+
+namespace quantpy {
+
+  namespace math {
+
+    namespace fourier {
+
+
+      /**
+       * @brief In-place radix-2 fast Fourier transform
+       * @details Iterative Cooley-Tukey implementation following Chapter 12.2 in Numerical Recipes [1]:
+       * the data is first permuted into bit-reversed order, after which the butterflies are applied in
+       * \f$ \log_2 N \f$ passes of growing span. The forward transform computes
+       * \f$ X_u = \sum_j x_j e^{-2 \pi i j u / N} \f$ and the inverse transform the conjugate sum
+       * scaled by \f$ 1 / N \f$.
+       * [1]: W. Press et. al., "Numerical Recipes: The Art of Scientific Computing", Cambridge University Press, 2007
+       * @tparam T       The template type. Should be some floating point type
+       * @param data     Pointer to the buffer of complex values transformed in place
+       * @param n        The number of values. Needs to be a power of two
+       * @param inverse  Boolean flag telling if the inverse transform is taken. Defaults to 'false'
+       * @returns        Void. The transform is written over the 'data' buffer
+       */
+      template <typename T>
+      void fft(std::complex<T>* data, int n, bool inverse = false) {
+
+        if ( n < 1 || (n & (n - 1)) != 0 ) {
+          ERROR("The transform length needs to be a power of two! (", n, ")");
+        }
+
+        // Permute the data into bit-reversed order
+        for (int i = 1, j = 0; i < n; i++) {
+
+          int bit = n >> 1;
+
+          for (; j & bit; bit >>= 1) {
+            j ^= bit;
+          }
+
+          j ^= bit;
+
+          if ( i < j ) {
+            std::swap(data[i], data[j]);
+          }
+
+        }
+
+        // Apply the butterflies in passes of growing span
+        for (int span = 2; span <= n; span <<= 1) {
+
+          T angle = (T)2. * (T)PI / (T)span * (inverse ? (T)1. : (T)-1.);
+          std::complex<T> root(cos(angle), sin(angle));
+
+          for (int start = 0; start < n; start += span) {
+
+            std::complex<T> twiddle((T)1., (T)0.);
+
+            for (int i = 0; i < span / 2; i++) {
+
+              std::complex<T> even = data[start + i];
+              std::complex<T> odd  = data[start + i + span / 2] * twiddle;
+
+              data[start + i]            = even + odd;
+              data[start + i + span / 2] = even - odd;
+
+              twiddle *= root;
+
+            }
+
+          }
+
+        }
+
+        if ( inverse ) {
+          for (int i = 0; i < n; i++) {
+            data[i] /= (T)n;
+          }
+        }
+
+      }
+
+
+    }
+
+  }
+
+}
+
+
+#endif
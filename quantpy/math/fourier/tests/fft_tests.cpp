@@ -0,0 +1,142 @@
+/**
+ * @file fft_tests.cpp
+ * @brief Definition of tests for the fast Fourier transform
+ * @details Compile in the main quantpy directory with:
+ * > g++ -std=c++17 -mavx -fopenmp -Wall quantpy/math/fourier/tests/fft_tests.cpp -lm -o fft_tests.o
+ * Run with:
+ * > ./fft_tests.o
+ * @author Kasper Rantamäki
+ * @date 2026-08-29
+ */
+
+#include <cmath>
+#include <complex>
+
+#include "../fft.hpp"
+#include "../../../cpp/testing.hpp"
+#include "../../../cpp/logging.hpp"
+
+
+#ifndef TEST_TOL
+  #define TEST_TOL 1e-10
+#endif
+
+
+namespace quantpy {
+
+  namespace math {
+
+    namespace fourier {
+
+      namespace fft_tests {
+
+
+        // Test 1
+        bool test_fft1() {
+
+          // A constant signal transforms into a single spike at zero frequency
+          std::complex<double> data[4] = { {1., 0.}, {1., 0.}, {1., 0.}, {1., 0.} };
+
+          fft<double>(data, 4);
+
+          bool passed = ( std::abs(data[0] - std::complex<double>(4., 0.)) < TEST_TOL );
+
+          for (int i = 1; i < 4; i++) {
+            passed = passed && ( std::abs(data[i]) < TEST_TOL );
+          }
+
+          return passed;
+
+        }
+
+
+        // Test 2
+        bool test_fft2() {
+
+          // A unit impulse transforms into a flat spectrum
+          std::complex<double> data[8] = { {1., 0.} };
+
+          fft<double>(data, 8);
+
+          bool passed = true;
+
+          for (int i = 0; i < 8; i++) {
+            passed = passed && ( std::abs(data[i] - std::complex<double>(1., 0.)) < TEST_TOL );
+          }
+
+          return passed;
+
+        }
+
+
+        // Test 3
+        bool test_fft3() {
+
+          std::complex<double> data[4] = { {1., 0.}, {2., -1.}, {0., -1.}, {-1., 2.} };
+
+          // Known transform values computed by hand from the definition
+          std::complex<double> correct[4] = { {2., 0.}, {-2., -2.}, {0., -2.}, {4., 4.} };
+
+          fft<double>(data, 4);
+
+          bool passed = true;
+
+          for (int i = 0; i < 4; i++) {
+            DEBUG("Found value: (", data[i].real(), ", ", data[i].imag(), ")");
+            passed = passed && ( std::abs(data[i] - correct[i]) < TEST_TOL );
+          }
+
+          return passed;
+
+        }
+
+
+        // Test 4
+        bool test_inverse1() {
+
+          std::complex<double> data[16];
+          std::complex<double> original[16];
+
+          for (int i = 0; i < 16; i++) {
+            data[i] = std::complex<double>(sin(0.3 * (double)i), cos(1.7 * (double)i));
+            original[i] = data[i];
+          }
+
+          // The forward and inverse transforms should round trip back to the original signal
+          fft<double>(data, 16);
+          fft<double>(data, 16, true);
+
+          bool passed = true;
+
+          for (int i = 0; i < 16; i++) {
+            passed = passed && ( std::abs(data[i] - original[i]) < TEST_TOL );
+          }
+
+          return passed;
+
+        }
+
+
+      }
+
+    }
+
+  }
+
+}
+
+
+int main() {
+
+  quantpy::cpp::logging::verbosity(3);
+
+  quantpy::cpp::testing::TestSuite fftTests = quantpy::cpp::testing::TestSuite("fft.hpp");
+
+  fftTests.addTest(quantpy::math::fourier::fft_tests::test_fft1);
+  fftTests.addTest(quantpy::math::fourier::fft_tests::test_fft2);
+  fftTests.addTest(quantpy::math::fourier::fft_tests::test_fft3);
+  fftTests.addTest(quantpy::math::fourier::fft_tests::test_inverse1);
+
+  return (int)fftTests.runTests();
+
+}
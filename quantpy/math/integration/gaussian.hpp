@@ -0,0 +1,316 @@
+/**
+ * @file gaussian.hpp
+ * @brief Implementation of Gauss-Legendre and Gauss-Laguerre quadrature with cached nodes
+ * @details The nodes and weights of an n-point Gaussian rule are the roots of the n:th orthogonal
+ * polynomial and depend only on n, so they are computed once per rule size with Newton iterations
+ * on the polynomial recurrences (following Chapter 4.6 in Numerical Recipes [1]) and cached for
+ * reuse. After the first call an integration costs just the n function evaluations — and as an
+ * n-point rule is exact for polynomials up to degree 2n - 1, smooth integrands converge with tens
+ * of evaluations where the fixed grids need a thousand.
+ * [1]: W. Press et. al., "Numerical Recipes: The Art of Scientific Computing", Cambridge University Press, 2007
+ * @author Kasper Rantamäki
+ * @date 2026-08-29
+ */
+
+#ifndef GAUSSIAN_HPP
+#define GAUSSIAN_HPP
+
+
+#ifndef PI
+  #define PI 3.141592653589793
+#endif
+
+
+#include <cmath>
+#include <functional>
+#include <map>
+#include <vector>
+
+#include "../../cpp/logging.hpp"
+
+
+namespace quantpy {
+
+  namespace math {
+
+    namespace integration {
+
+
+      /**
+       * @brief Struct for holding the nodes and weights of a quadrature rule
+       * @tparam T  The template type. Should be some floating point type
+       */
+      template <typename T>
+      struct QuadratureRule {
+
+        std::vector<T> nodes;    /**< The quadrature nodes */
+        std::vector<T> weights;  /**< The quadrature weights */
+
+      };
+
+
+      /**
+       * @brief Accessor for the cached Gauss-Legendre rule of a given size
+       * @details The first call for a size computes the nodes on the reference interval [-1, 1] with
+       * Newton iterations on the Legendre recurrence and caches them. The cache is per thread, so no
+       * locking is needed on the integration path
+       * @tparam T  The template type. Should be some floating point type
+       * @param n   The number of quadrature points
+       * @returns   A reference to the cached rule
+       */
+      template <typename T>
+      const QuadratureRule<T>& __gaussLegendreRule(int n) {
+
+        static thread_local std::map<int, QuadratureRule<T>> cache;
+
+        auto found = cache.find(n);
+
+        if ( found != cache.end() ) {
+          return found->second;
+        }
+
+        QuadratureRule<T> rule;
+        rule.nodes.resize(n);
+        rule.weights.resize(n);
+
+        // The roots are symmetric about zero, so only half of them need to be found
+        for (int i = 0; i < (n + 1) / 2; i++) {
+
+          T z = cos((T)PI * ((T)i + (T)0.75) / ((T)n + (T)0.5));
+          T pp = (T)0.;
+
+          for (int iter = 0; iter < 100; iter++) {
+
+            // Evaluate the Legendre polynomial at z through the recurrence
+            T p1 = (T)1.;
+            T p2 = (T)0.;
+
+            for (int j = 1; j <= n; j++) {
+              T p3 = p2;
+              p2 = p1;
+              p1 = (((T)(2 * j - 1) * z * p2 - (T)(j - 1) * p3)) / (T)j;
+            }
+
+            pp = (T)n * (z * p1 - p2) / (z * z - (T)1.);
+
+            T step = p1 / pp;
+            z -= step;
+
+            if ( fabs(step) < (T)1e-15 ) {
+              break;
+            }
+
+          }
+
+          rule.nodes[i]         = -z;
+          rule.nodes[n - 1 - i] = z;
+
+          rule.weights[i]         = (T)2. / (((T)1. - z * z) * pp * pp);
+          rule.weights[n - 1 - i] = rule.weights[i];
+
+        }
+
+        return cache[n] = rule;
+
+      }
+
+
+      /**
+       * @brief Accessor for the cached Gauss-Laguerre rule of a given size
+       * @details The first call for a size computes the nodes on \f$ [0, \infty) \f$ with Newton
+       * iterations on the Laguerre recurrence and caches them. The weights absorb the \f$ e^{x} \f$
+       * factor, so the rule applies directly to plain integrals over the half line rather than to
+       * integrands with an explicit \f$ e^{-x} \f$ weight. The cache is per thread, so no locking is
+       * needed on the integration path
+       * @tparam T  The template type. Should be some floating point type
+       * @param n   The number of quadrature points
+       * @returns   A reference to the cached rule
+       */
+      template <typename T>
+      const QuadratureRule<T>& __gaussLaguerreRule(int n) {
+
+        static thread_local std::map<int, QuadratureRule<T>> cache;
+
+        auto found = cache.find(n);
+
+        if ( found != cache.end() ) {
+          return found->second;
+        }
+
+        QuadratureRule<T> rule;
+        rule.nodes.resize(n);
+        rule.weights.resize(n);
+
+        T z = (T)0.;
+
+        for (int i = 0; i < n; i++) {
+
+          // Initial guesses from Numerical Recipes, anchored on the previous roots
+          if ( i == 0 ) {
+            z = (T)3. / ((T)1. + (T)2.4 * (T)n);
+          }
+          else if ( i == 1 ) {
+            z += (T)15. / ((T)1. + (T)2.5 * (T)n);
+          }
+          else {
+            T ai = (T)(i - 1);
+            z += (((T)1. + (T)2.55 * ai) / ((T)1.9 * ai)) * (z - rule.nodes[i - 2]);
+          }
+
+          T pp = (T)0.;
+          T p2 = (T)0.;
+
+          for (int iter = 0; iter < 100; iter++) {
+
+            // Evaluate the Laguerre polynomial at z through the recurrence
+            T p1 = (T)1.;
+            p2 = (T)0.;
+
+            for (int j = 1; j <= n; j++) {
+              T p3 = p2;
+              p2 = p1;
+              p1 = (((T)(2 * j - 1) - z) * p2 - (T)(j - 1) * p3) / (T)j;
+            }
+
+            pp = (T)n * (p1 - p2) / z;
+
+            T step = p1 / pp;
+            z -= step;
+
+            if ( fabs(step) < (T)1e-14 * z ) {
+              break;
+            }
+
+          }
+
+          rule.nodes[i] = z;
+
+          // The plain Laguerre weight scaled by e^z so the rule integrates f directly
+          rule.weights[i] = -exp(z) / (pp * (T)n * p2);
+
+        }
+
+        return cache[n] = rule;
+
+      }
+
+
+      /**
+       * @brief Calculates a numerical estimate to definite integrals by Gauss-Legendre quadrature
+       * @details The cached reference rule is mapped affinely onto the integration interval. An
+       * n-point rule integrates polynomials up to degree 2n - 1 exactly, so for smooth integrands
+       * the default size is already far inside machine precision.
+       * The callable is taken as a generic template parameter, so lambdas inline into the
+       * evaluation loop without the indirect call a std::function would force
+       * @tparam T     The template type. Should be some floating point type
+       * @tparam Func  The callable type. Should map T to T
+       * @param func   The function which integral is to be evaluated
+       * @param a      The start point of the integral
+       * @param b      The end point of the integral
+       * @param n      The number of quadrature points. Defaults to 32
+       * @returns      The integral estimate
+       */
+      template <typename T, typename Func>
+      T gaussLegendre(Func&& func, T a, T b, int n = 32) {
+
+        if ( a >= b ) {
+          ERROR("The start point needs to be smaller than the end point! (", a, " >= ", b, ")");
+        }
+
+        if ( n < 1 ) {
+          ERROR("The number of quadrature points needs to be positive! (", n, " < 1)");
+        }
+
+        const QuadratureRule<T>& rule = __gaussLegendreRule<T>(n);
+
+        T mid  = (a + b) / (T)2.;
+        T half = (b - a) / (T)2.;
+
+        T sum = (T)0.;
+
+        for (int i = 0; i < n; i++) {
+          sum += rule.weights[i] * func(mid + half * rule.nodes[i]);
+        }
+
+        return half * sum;
+
+      }
+
+
+      /**
+       * @brief Overload of 'gaussLegendre' taking a std::function
+       * @details Thin wrapper kept so type-erased callables and existing call sites keep working.
+       * Forwards to the generic overload
+       * @tparam T    The template type. Should be some floating point type
+       * @param func  The function which integral is to be evaluated
+       * @param a     The start point of the integral
+       * @param b     The end point of the integral
+       * @param n     The number of quadrature points. Defaults to 32
+       * @returns     The integral estimate
+       */
+      template <typename T>
+      T gaussLegendre(std::function<T (T)> func, T a, T b, int n = 32) {
+
+        return gaussLegendre<T, std::function<T (T)>&>(func, a, b, n);
+
+      }
+
+
+      /**
+       * @brief Calculates a numerical estimate to integrals over \f$ [0, \infty) \f$ by Gauss-Laguerre quadrature
+       * @details The cached weights absorb the exponential factor, so the integrand is passed as is.
+       * Best suited for integrands with roughly exponential decay — e.g. the tails appearing in the
+       * probability distributions — where a handful of points covers the whole half line.
+       * The callable is taken as a generic template parameter, so lambdas inline into the
+       * evaluation loop without the indirect call a std::function would force
+       * @tparam T     The template type. Should be some floating point type
+       * @tparam Func  The callable type. Should map T to T
+       * @param func   The function which integral is to be evaluated
+       * @param n      The number of quadrature points. Defaults to 32
+       * @returns      The integral estimate
+       */
+      template <typename T, typename Func>
+      T gaussLaguerre(Func&& func, int n = 32) {
+
+        if ( n < 1 ) {
+          ERROR("The number of quadrature points needs to be positive! (", n, " < 1)");
+        }
+
+        const QuadratureRule<T>& rule = __gaussLaguerreRule<T>(n);
+
+        T sum = (T)0.;
+
+        for (int i = 0; i < n; i++) {
+          sum += rule.weights[i] * func(rule.nodes[i]);
+        }
+
+        return sum;
+
+      }
+
+
+      /**
+       * @brief Overload of 'gaussLaguerre' taking a std::function
+       * @details Thin wrapper kept so type-erased callables and existing call sites keep working.
+       * Forwards to the generic overload
+       * @tparam T    The template type. Should be some floating point type
+       * @param func  The function which integral is to be evaluated
+       * @param n     The number of quadrature points. Defaults to 32
+       * @returns     The integral estimate
+       */
+      template <typename T>
+      T gaussLaguerre(std::function<T (T)> func, int n = 32) {
+
+        return gaussLaguerre<T, std::function<T (T)>&>(func, n);
+
+      }
+
+
+    }
+
+  }
+
+}
+
+
+#endif
@@ -13,6 +13,7 @@
 #include <omp.h>
 
 #include "../../cpp/logging.hpp"
+#include "../../cpp/reduction.hpp"
 
 
 namespace quantpy {
@@ -26,15 +27,18 @@ namespace quantpy {
        * @brief Calculates a numerical estimate to definite integrals by the Simpson's rule
        * @details Based on the implementation given in Chapter 4.2 in Numerical Recipes [1]
        * The Simpson's rule has an error of order \f$ O(n^{-4}) \f$
+       * The callable is taken as a generic template parameter, so lambdas inline into the
+       * evaluation loop without the indirect call a std::function would force
        * [1]: W. Press et. al., "Numerical Recipes: The Art of Scientific Computing", Cambridge University Press, 2007
-       * @tparam T    The template type. Should be some floating point type
-       * @param func  The function which integral is to be evaluated
-       * @param a     The start point of the integral
-       * @param b     The end point of the integral
-       * @param n     The number of interior points used
+       * @tparam T     The template type. Should be some floating point type
+       * @tparam Func  The callable type. Should map T to T
+       * @param func   The function which integral is to be evaluated
+       * @param a      The start point of the integral
+       * @param b      The end point of the integral
+       * @param n      The number of interior points used
        */
-      template <typename T>
-      T simpson(std::function<T (T)> func, T a, T b, int n) {
+      template <typename T, typename Func>
+      T simpson(Func&& func, T a, T b, int n) {
 
         if ( a >= b ) {
           ERROR("The start point needs to be smaller than the end point! (", a, " >= ", b, ")");
@@ -46,7 +50,7 @@ namespace quantpy {
 
         // The total integral sum
         T intSum = (T)1./(T)3. * (func(a) + func(b));
-        
+
         // The finite difference is discerned from the start and end point and the number of interior points
         T h = (b - a) / (T)n;
 
@@ -54,35 +58,44 @@ namespace quantpy {
         T twoThirds  = (T)2. / (T)3.;
         T fourThirds = (T)2. * twoThirds;
 
-        #pragma omp parallel
-        {
-          // The integral sum within a single thread
-          T intThreadSum = (T)0.;
-
-          #pragma omp for nowait 
-          for (int i = 1; i < n - 1; i++) {
+        // The interior points are split into branch-free strided passes over the odd and even
+        // indices, each summed with the shared deterministic reduction
+        int nOdd  = (n - 1) / 2;
+        int nEven = (n - 2) / 2;
 
-            if ( i % 2 == 0 ) {
-              intThreadSum += twoThirds * func(a + i * h);
-            }
-            else {
-              intThreadSum += fourThirds * func(a + i * h);
-            }
+        T oddSum = quantpy::cpp::reduction::parallelSum<T>(nOdd, [&](int i) {
+          return func(a + (T)(2 * i + 1) * h);
+        });
 
-          }
+        T evenSum = quantpy::cpp::reduction::parallelSum<T>(nEven, [&](int i) {
+          return func(a + (T)(2 * i + 2) * h);
+        });
 
-          #pragma omp critical
-          {
-            // Accumulate the thread sums together
-            intSum += intThreadSum;
-          }
-        }
+        intSum += fourThirds * oddSum + twoThirds * evenSum;
 
         return h * intSum;
 
       }
 
 
+      /**
+       * @brief Overload of 'simpson' taking a std::function
+       * @details Thin wrapper kept so type-erased callables and existing call sites keep working.
+       * Forwards to the generic overload
+       * @tparam T    The template type. Should be some floating point type
+       * @param func  The function which integral is to be evaluated
+       * @param a     The start point of the integral
+       * @param b     The end point of the integral
+       * @param n     The number of interior points used
+       */
+      template <typename T>
+      T simpson(std::function<T (T)> func, T a, T b, int n) {
+
+        return simpson<T, std::function<T (T)>&>(func, a, b, n);
+
+      }
+
+
     }
     
   } 
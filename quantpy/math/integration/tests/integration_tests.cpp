@@ -12,6 +12,8 @@
 
 #include <cmath>
 
+#include "../adaptive.hpp"
+#include "../gaussian.hpp"
 #include "../simpson.hpp"
 #include "../trapezoidal.hpp"
 #include "../../../cpp/testing.hpp"
@@ -89,7 +91,84 @@ namespace quantpy {
 
           return ( fabs(correctIntegrand - foundIntegrand) < TEST_TOL );
 
-        } 
+        }
+
+
+        // Test 5
+        bool test_adaptiveSimpson1() {
+
+          auto func = [](double x) { return cos(3. * x); };
+
+          double correctIntegrand = sin(15.) / 3.;
+          double foundIntegrand = adaptiveSimpson<double>(func, 0., 5., 1e-12);
+
+          DEBUG("Found integrand: ", foundIntegrand);
+
+          return ( fabs(correctIntegrand - foundIntegrand) < 1e-10 );
+
+        }
+
+
+        // Test 6
+        bool test_adaptiveSimpson2() {
+
+          // A sharp peak at x = 0.5 that a coarse fixed grid would miss entirely
+          auto func = [](double x) { return 1. / ((x - 0.5) * (x - 0.5) + 1e-4); };
+
+          double correctIntegrand = 100. * (atan(50.) + atan(150.));
+          double foundIntegrand = adaptiveSimpson<double>(func, 0., 2., 1e-8);
+
+          DEBUG("Found integrand: ", foundIntegrand);
+
+          return ( fabs(correctIntegrand - foundIntegrand) < 1e-6 );
+
+        }
+
+
+        // Test 7
+        bool test_gaussLegendre1() {
+
+          // An n-point rule is exact for polynomials up to degree 2n - 1
+          auto func = [](double x) { return x * x * x * x * x - 2. * x * x + 1.; };
+
+          double correctIntegrand = 22. / 3.;
+          double foundIntegrand = gaussLegendre<double>(func, 0., 2., 3);
+
+          DEBUG("Found integrand: ", foundIntegrand);
+
+          return ( fabs(correctIntegrand - foundIntegrand) < 1e-12 );
+
+        }
+
+
+        // Test 8
+        bool test_gaussLegendre2() {
+
+          auto func = [](double x) { return cos(3. * x); };
+
+          double correctIntegrand = sin(15.) / 3.;
+          double foundIntegrand = gaussLegendre<double>(func, 0., 5.);
+
+          DEBUG("Found integrand: ", foundIntegrand);
+
+          return ( fabs(correctIntegrand - foundIntegrand) < 1e-12 );
+
+        }
+
+
+        // Test 9
+        bool test_gaussLaguerre1() {
+
+          auto func = [](double x) { return x * x * x * exp(-x); };
+
+          double correctIntegrand = 6.;
+          double foundIntegrand = gaussLaguerre<double>(func);
+
+          DEBUG("Found integrand: ", foundIntegrand);
+
+          return ( fabs(correctIntegrand - foundIntegrand) < 1e-8 );
+
+        }
 
 
       }
@@ -111,6 +190,11 @@ int main() {
   integrationTests.addTest(quantpy::math::integration::integral_tests::test_simpson1);
   integrationTests.addTest(quantpy::math::integration::integral_tests::test_trapezoidal2);
   integrationTests.addTest(quantpy::math::integration::integral_tests::test_simpson2);
+  integrationTests.addTest(quantpy::math::integration::integral_tests::test_adaptiveSimpson1);
+  integrationTests.addTest(quantpy::math::integration::integral_tests::test_adaptiveSimpson2);
+  integrationTests.addTest(quantpy::math::integration::integral_tests::test_gaussLegendre1);
+  integrationTests.addTest(quantpy::math::integration::integral_tests::test_gaussLegendre2);
+  integrationTests.addTest(quantpy::math::integration::integral_tests::test_gaussLaguerre1);
 
   return (int)integrationTests.runTests();
 
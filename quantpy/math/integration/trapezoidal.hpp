@@ -26,15 +26,18 @@ namespace quantpy {
        * @brief Calculates a numerical estimate to definite integrals by the Trapezoidal rule
        * @details Based on the implementation given in Chapter 4.2 in Numerical Recipes [1]
        * The Trapezoidal rule has an error of order \f$ O(\frac{(b - a)^3 f''}{n^2}) \f$
+       * The callable is taken as a generic template parameter, so lambdas inline into the
+       * evaluation loop without the indirect call a std::function would force
        * [1]: W. Press et. al., "Numerical Recipes: The Art of Scientific Computing", Cambridge University Press, 2007
-       * @tparam T    The template type. Should be some floating point type
-       * @param func  The function which integral is to be evaluated
-       * @param a     The start point of the integral
-       * @param b     The end point of the integral
-       * @param n     The number of interior points used
+       * @tparam T     The template type. Should be some floating point type
+       * @tparam Func  The callable type. Should map T to T
+       * @param func   The function which integral is to be evaluated
+       * @param a      The start point of the integral
+       * @param b      The end point of the integral
+       * @param n      The number of interior points used
        */
-      template <typename T>
-      T trapezoidal(std::function<T (T)> func, T a, T b, int n) {
+      template <typename T, typename Func>
+      T trapezoidal(Func&& func, T a, T b, int n) {
 
         if ( a >= b ) {
           ERROR("The start point needs to be smaller than the end point! (", a, " >= ", b, ")");
@@ -72,6 +75,24 @@ namespace quantpy {
       }
 
 
+      /**
+       * @brief Overload of 'trapezoidal' taking a std::function
+       * @details Thin wrapper kept so type-erased callables and existing call sites keep working.
+       * Forwards to the generic overload
+       * @tparam T    The template type. Should be some floating point type
+       * @param func  The function which integral is to be evaluated
+       * @param a     The start point of the integral
+       * @param b     The end point of the integral
+       * @param n     The number of interior points used
+       */
+      template <typename T>
+      T trapezoidal(std::function<T (T)> func, T a, T b, int n) {
+
+        return trapezoidal<T, std::function<T (T)>&>(func, a, b, n);
+
+      }
+
+
     }
     
   } 
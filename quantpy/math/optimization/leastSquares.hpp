@@ -0,0 +1,282 @@
+/**
+ * @file leastSquares.hpp
+ * @brief Nonlinear least-squares solvers
+ * @details Implements the Levenberg-Marquardt method [1, 2] for minimizing a sum of squared
+ * residuals over a small number of parameters. The main use case is calibrating the parameters of
+ * the closed form pricers to observed market curves, where the residual count (the observation
+ * grid) is much larger than the parameter count and each residual evaluation pays for a pricing
+ * call. The residual vector and the finite difference Jacobian are therefore evaluated in parallel
+ * over the observations, while the small normal equations are solved serially.
+ * [1]: K. Levenberg, "A method for the solution of certain non-linear problems in least squares",
+ * Quarterly of Applied Mathematics, vol. 2, no. 2, pp. 164-168, 1944
+ * [2]: D. Marquardt, "An algorithm for least-squares estimation of nonlinear parameters",
+ * Journal of the Society for Industrial and Applied Mathematics, vol. 11, no. 2, pp. 431-441, 1963
+ * @author Kasper Rantamäki
+ * @date 2026-08-29
+ */
+
+#ifndef LEAST_SQUARES_HPP
+#define LEAST_SQUARES_HPP
+
+
+#include <cmath>
+#include <functional>
+#include <vector>
+#include <omp.h>
+
+#include "../../cpp/logging.hpp"
+
+
+namespace quantpy {
+
+  namespace math {
+
+    namespace optimization {
+
+      namespace leastSquares {
+
+
+        /**
+         * @brief Solves a small dense linear system with Gaussian elimination. To be called by 'levenbergMarquardt'
+         * @tparam T   The template type. Should be some floating point number type
+         * @param lhs  The coefficient matrix in row-major order. Modified in place
+         * @param rhs  The right-hand side vector. Overwritten with the solution
+         * @param p    The dimension of the system
+         * @returns    Void. The solution is written over the 'rhs' vector
+         */
+        template <typename T>
+        void __solveDense(std::vector<T>& lhs, std::vector<T>& rhs, int p) {
+
+          for (int col = 0; col < p; col++) {
+
+            // Partial pivoting
+            int pivot = col;
+
+            for (int row = col + 1; row < p; row++) {
+              if ( fabs(lhs[row * p + col]) > fabs(lhs[pivot * p + col]) ) {
+                pivot = row;
+              }
+            }
+
+            if ( lhs[pivot * p + col] == (T)0. ) {
+              ERROR("The coefficient matrix is singular!");
+            }
+
+            if ( pivot != col ) {
+              for (int i = 0; i < p; i++) {
+                std::swap(lhs[col * p + i], lhs[pivot * p + i]);
+              }
+              std::swap(rhs[col], rhs[pivot]);
+            }
+
+            for (int row = col + 1; row < p; row++) {
+
+              T factor = lhs[row * p + col] / lhs[col * p + col];
+
+              for (int i = col; i < p; i++) {
+                lhs[row * p + i] -= factor * lhs[col * p + i];
+              }
+
+              rhs[row] -= factor * rhs[col];
+
+            }
+
+          }
+
+          for (int row = p - 1; row >= 0; row--) {
+
+            for (int i = row + 1; i < p; i++) {
+              rhs[row] -= lhs[row * p + i] * rhs[i];
+            }
+
+            rhs[row] /= lhs[row * p + row];
+
+          }
+
+        }
+
+
+        /**
+         * @brief The Levenberg-Marquardt method for nonlinear least-squares
+         * @details Minimizes \f$ \sum_i r_i(x)^2 \f$ by interpolating between the Gauss-Newton step
+         * and gradient descent through the damping parameter \f$ \lambda \f$: steps that reduce the
+         * cost are accepted and the damping relaxed towards Gauss-Newton, while failed steps tighten
+         * the damping towards a short gradient descent step. The Jacobian is approximated with
+         * forward differences and both it and the residual vector are evaluated in parallel over the
+         * residual index, so residual functions need to be safe to call concurrently for distinct
+         * indices.
+         * The callable is taken as a generic template parameter, so lambdas inline into the
+         * evaluation loops without the indirect call a std::function would force
+         * @tparam T            The template type. Should be some floating point number type
+         * @tparam Func         The callable type. Should map a parameter vector and a residual index to T
+         * @param residual      Function evaluating a single residual \f$ r_i(x) \f$ given the parameter vector and the index \f$ i \f$
+         * @param nResiduals    The number of residuals. Should be at least the number of parameters
+         * @param initialGuess  The initial guess for the parameter vector
+         * @param atol          The tolerance for the stopping condition (absolute tolerance): \f$ \| J^T r \|_\infty < atol \f$. Defaults to 1e-10
+         * @param maxIter       The maximum number of iterations. Defaults to 100
+         * @param h             The relative finite difference step size used for the Jacobian. Defaults to 1e-6
+         * @returns             The parameter vector minimizing the sum of squared residuals
+         */
+        template <typename T, typename Func>
+        std::vector<T> levenbergMarquardt(Func&& residual, int nResiduals,
+                                          std::vector<T> initialGuess, T atol = 1e-10, int maxIter = 100, T h = 1e-6) {
+
+          int m = nResiduals;
+          int p = (int)initialGuess.size();
+
+          if ( p < 1 ) {
+            ERROR("The parameter vector can not be empty!");
+          }
+
+          if ( m < p ) {
+            ERROR("The problem needs at least as many residuals as parameters! (", m, " < ", p, ")");
+          }
+
+          std::vector<T> params = initialGuess;
+          std::vector<T> residuals(m);
+          std::vector<T> jacobian(m * p);
+
+          T lambda = (T)1e-3;
+
+          for (int iter = 0; iter < maxIter; iter++) {
+
+            // Evaluate the residual vector and the forward difference Jacobian in parallel over
+            // the observations
+            #pragma omp parallel for schedule(static)
+            for (int i = 0; i < m; i++) {
+
+              residuals[i] = residual(params, i);
+
+              std::vector<T> perturbed = params;
+
+              for (int j = 0; j < p; j++) {
+
+                T step = h * (fabs(params[j]) + (T)1.);
+
+                perturbed[j] = params[j] + step;
+                jacobian[i * p + j] = (residual(perturbed, i) - residuals[i]) / step;
+                perturbed[j] = params[j];
+
+              }
+
+            }
+
+            T cost = (T)0.;
+
+            for (int i = 0; i < m; i++) {
+              cost += residuals[i] * residuals[i];
+            }
+
+            // Form the normal equations J^T J and the gradient J^T r
+            std::vector<T> hessian(p * p, (T)0.);
+            std::vector<T> gradient(p, (T)0.);
+
+            for (int i = 0; i < m; i++) {
+              for (int j = 0; j < p; j++) {
+
+                gradient[j] += jacobian[i * p + j] * residuals[i];
+
+                for (int l = 0; l < p; l++) {
+                  hessian[j * p + l] += jacobian[i * p + j] * jacobian[i * p + l];
+                }
+
+              }
+            }
+
+            T maxGradient = (T)0.;
+
+            for (int j = 0; j < p; j++) {
+              maxGradient = fabs(gradient[j]) > maxGradient ? fabs(gradient[j]) : maxGradient;
+            }
+
+            if ( maxGradient < atol ) {
+              return params;
+            }
+
+            // Try damped steps until one reduces the cost
+            bool accepted = false;
+
+            while ( !accepted && lambda < (T)1e12 ) {
+
+              std::vector<T> damped = hessian;
+              std::vector<T> step(p);
+
+              // Marquardt scaling: the damping is applied relative to the curvature of each parameter
+              for (int j = 0; j < p; j++) {
+                damped[j * p + j] += lambda * hessian[j * p + j];
+                step[j] = -gradient[j];
+              }
+
+              __solveDense(damped, step, p);
+
+              std::vector<T> candidate = params;
+
+              for (int j = 0; j < p; j++) {
+                candidate[j] += step[j];
+              }
+
+              T candidateCost = (T)0.;
+
+              #pragma omp parallel for schedule(static) reduction(+:candidateCost)
+              for (int i = 0; i < m; i++) {
+                T ri = residual(candidate, i);
+                candidateCost += ri * ri;
+              }
+
+              if ( candidateCost < cost ) {
+                params = candidate;
+                lambda = lambda / (T)10. > (T)1e-12 ? lambda / (T)10. : (T)1e-12;
+                accepted = true;
+              }
+              else {
+                lambda *= (T)10.;
+              }
+
+            }
+
+            if ( !accepted ) {
+              // No damping produced a descent step, so the iteration has stalled at the current point
+              return params;
+            }
+
+          }
+
+          WARNING("The Levenberg-Marquardt iteration did not converge in ", maxIter, " iterations!");
+
+          return params;
+
+        }
+
+
+        /**
+         * @brief Overload of 'levenbergMarquardt' taking a std::function
+         * @details Thin wrapper kept so type-erased callables and existing call sites keep working.
+         * Forwards to the generic overload
+         * @tparam T            The template type. Should be some floating point number type
+         * @param residual      Function evaluating a single residual \f$ r_i(x) \f$ given the parameter vector and the index \f$ i \f$
+         * @param nResiduals    The number of residuals. Should be at least the number of parameters
+         * @param initialGuess  The initial guess for the parameter vector
+         * @param atol          The tolerance for the stopping condition (absolute tolerance). Defaults to 1e-10
+         * @param maxIter       The maximum number of iterations. Defaults to 100
+         * @param h             The relative finite difference step size used for the Jacobian. Defaults to 1e-6
+         * @returns             The parameter vector minimizing the sum of squared residuals
+         */
+        template <typename T>
+        std::vector<T> levenbergMarquardt(std::function<T (const std::vector<T>&, int)> residual, int nResiduals,
+                                          std::vector<T> initialGuess, T atol = 1e-10, int maxIter = 100, T h = 1e-6) {
+
+          return levenbergMarquardt<T, std::function<T (const std::vector<T>&, int)>&>(residual, nResiduals, initialGuess, atol, maxIter, h);
+
+        }
+
+
+      }
+
+    }
+
+  }
+
+}
+
+
+#endif
@@ -25,25 +25,33 @@ namespace quantpy {
 
         /**
          * @brief Simple templated bisection method for finding the root of a function
+         * @details The callable is taken as a generic template parameter, so lambdas inline into the
+         * iteration without the indirect call a std::function would force
          * @tparam T     The template type. Should support basic math operation like addition and division
+         * @tparam Func  The callable type. Should map T to T
          * @param func   The function of which root is to be found
          * @param start  The start point of the search interval
          * @param end    The end point of the search interval. Inequality 'start' < 'end' should hold
-         * @param atol   The tolerance for stopping condition (absolute tolerance): \f$ |V_n - V_{n - 1}| < atol \f$. Defaults to 1e-6. 
+         * @param atol   The tolerance for stopping condition (absolute tolerance): \f$ |V_n - V_{n - 1}| < atol \f$. Defaults to 1e-6.
          * If 'func' is a discrete function the default value doesn't compile
-         * @param rtol   The tolerance for stopping condition (relative tolerance): \f$ \left| \frac{V_n - V_{n - 1}}{V_n} \right| < atol \f$. Defaults to 1e-6. 
+         * @param rtol   The tolerance for stopping condition (relative tolerance): \f$ \left| \frac{V_n - V_{n - 1}}{V_n} \right| < atol \f$. Defaults to 1e-6.
          * If 'func' is a discrete function the default value doesn't compile
          * @returns      The root of the function
          */
-        template <typename T>
-        T bisectionMethod(std::function<T (T)> func, T start, T end, T atol = 1e-6, T rtol = 1e-6) {
+        template <typename T, typename Func>
+        T bisectionMethod(Func&& func, T start, T end, T atol = 1e-6, T rtol = 1e-6) {
 
           if ( start >= end ) {
             ERROR("Start point needs to be lower than the end point! (", start, " !< ", end, ")");
           }
 
-          if ( func(start) * func(end) > 0 ) {
-            ERROR("Function value at start point needs to have different sign to the value at end point! (", func(start), " has the same sign as ", func(end), ")");
+          // The endpoint values are evaluated once and tracked through the iteration, so halving
+          // the interval costs a single evaluation of e.g. an expensive pricing kernel
+          T func_start = func(start);
+          T func_end = func(end);
+
+          if ( func_start * func_end > 0 ) {
+            ERROR("Function value at start point needs to have different sign to the value at end point! (", func_start, " has the same sign as ", func_end, ")");
           }
 
           T mid = (end + start) / (T)2.;
@@ -53,17 +61,18 @@ namespace quantpy {
             return mid;
           }
 
-          T last_func_mid = func(end); 
+          T last_func_mid = func_end;
 
           while ( (fabs(func_mid - last_func_mid) > atol) | (fabs((func_mid - last_func_mid) / func_mid) > rtol) ) {
 
             last_func_mid = func_mid;
 
-            if ( func_mid * func(start) < (T)0. ) { 
+            if ( func_mid * func_start < (T)0. ) {
               end = mid;
             }
             else {
               start = mid;
+              func_start = func_mid;
             }
 
             mid = (end + start) / (T)2.;
@@ -76,6 +85,227 @@ namespace quantpy {
         }
 
 
+        /**
+         * @brief Overload of 'bisectionMethod' taking a std::function
+         * @details Thin wrapper kept so type-erased callables and existing call sites keep working.
+         * Forwards to the generic overload
+         * @tparam T     The template type. Should support basic math operation like addition and division
+         * @param func   The function of which root is to be found
+         * @param start  The start point of the search interval
+         * @param end    The end point of the search interval. Inequality 'start' < 'end' should hold
+         * @param atol   The tolerance for stopping condition (absolute tolerance). Defaults to 1e-6
+         * @param rtol   The tolerance for stopping condition (relative tolerance). Defaults to 1e-6
+         * @returns      The root of the function
+         */
+        template <typename T>
+        T bisectionMethod(std::function<T (T)> func, T start, T end, T atol = 1e-6, T rtol = 1e-6) {
+
+          return bisectionMethod<T, std::function<T (T)>&>(func, start, end, atol, rtol);
+
+        }
+
+
+        /**
+         * @brief Simple templated Newton-Raphson method for finding the root of a function
+         * @details Converges quadratically near the root, so when a good initial guess and the analytical
+         * derivative are available the root is typically found in a handful of iterations instead of the
+         * dozens required by the bisection method. Note that the method is not safeguarded: for poor
+         * initial guesses the iteration can wander, in which case a bracketed method should be preferred.
+         * The callables are taken as generic template parameters, so lambdas inline into the
+         * iteration without the indirect call a std::function would force
+         * @tparam T       The template type. Should support basic math operation like addition and division
+         * @tparam Func    The callable type of the function. Should map T to T
+         * @tparam Deriv   The callable type of the derivative. Should map T to T
+         * @param func     The function of which root is to be found
+         * @param deriv    The derivative of the function
+         * @param x0       The initial guess for the root
+         * @param atol     The tolerance for the stopping condition (absolute tolerance): \f$ |f(x_n)| < atol \f$
+         * or \f$ |x_n - x_{n - 1}| < atol \f$. Defaults to 1e-6
+         * @param maxIter  The maximum number of iterations. Defaults to 100
+         * @returns        The root of the function
+         */
+        template <typename T, typename Func, typename Deriv>
+        T newtonRaphson(Func&& func, Deriv&& deriv, T x0, T atol = 1e-6, int maxIter = 100) {
+
+          T x = x0;
+
+          for (int i = 0; i < maxIter; i++) {
+
+            T func_x = func(x);
+
+            if ( fabs(func_x) < atol ) {
+              return x;
+            }
+
+            T deriv_x = deriv(x);
+
+            if ( deriv_x == (T)0. ) {
+              WARNING("The derivative vanished at ", x, "!");
+              return x;
+            }
+
+            T step = func_x / deriv_x;
+            x -= step;
+
+            if ( fabs(step) < atol ) {
+              return x;
+            }
+
+          }
+
+          WARNING("The Newton-Raphson iteration did not converge in ", maxIter, " iterations!");
+
+          return x;
+
+        }
+
+
+        /**
+         * @brief Overload of 'newtonRaphson' taking std::functions
+         * @details Thin wrapper kept so type-erased callables and existing call sites keep working.
+         * Forwards to the generic overload
+         * @tparam T       The template type. Should support basic math operation like addition and division
+         * @param func     The function of which root is to be found
+         * @param deriv    The derivative of the function
+         * @param x0       The initial guess for the root
+         * @param atol     The tolerance for the stopping condition (absolute tolerance). Defaults to 1e-6
+         * @param maxIter  The maximum number of iterations. Defaults to 100
+         * @returns        The root of the function
+         */
+        template <typename T>
+        T newtonRaphson(std::function<T (T)> func, std::function<T (T)> deriv, T x0, T atol = 1e-6, int maxIter = 100) {
+
+          return newtonRaphson<T, std::function<T (T)>&, std::function<T (T)>&>(func, deriv, x0, atol, maxIter);
+
+        }
+
+
+        /**
+         * @brief Simple templated Brent method for finding the root of a function
+         * @details Combines inverse quadratic interpolation and the secant method with a bisection
+         * safeguard following Brent [1]. The bracket shrinks at least as fast as with the bisection
+         * method, but near the root the interpolation steps converge superlinearly, typically cutting
+         * the number of function evaluations by an order of magnitude. No derivative is needed.
+         * The callable is taken as a generic template parameter, so lambdas inline into the
+         * iteration without the indirect call a std::function would force
+         * [1]: R. Brent. "Algorithms for Minimization without Derivatives", Prentice-Hall, 1973
+         * @tparam T       The template type. Should support basic math operation like addition and division
+         * @tparam Func    The callable type. Should map T to T
+         * @param func     The function of which root is to be found
+         * @param start    The start point of the search interval
+         * @param end      The end point of the search interval. Inequality 'start' < 'end' should hold
+         * @param atol     The tolerance for the stopping condition (absolute tolerance): \f$ |b - a| < atol \f$. Defaults to 1e-6
+         * @param maxIter  The maximum number of iterations. Defaults to 100
+         * @returns        The root of the function
+         */
+        template <typename T, typename Func>
+        T brentMethod(Func&& func, T start, T end, T atol = 1e-6, int maxIter = 100) {
+
+          if ( start >= end ) {
+            ERROR("Start point needs to be lower than the end point! (", start, " !< ", end, ")");
+          }
+
+          T a = start;
+          T b = end;
+          T func_a = func(a);
+          T func_b = func(b);
+
+          if ( func_a * func_b > 0 ) {
+            ERROR("Function value at start point needs to have different sign to the value at end point! (", func_a, " has the same sign as ", func_b, ")");
+          }
+
+          // Keep the better of the two estimates in 'b'
+          if ( fabs(func_a) < fabs(func_b) ) {
+            T tmp = a; a = b; b = tmp;
+            tmp = func_a; func_a = func_b; func_b = tmp;
+          }
+
+          T c = a;
+          T func_c = func_a;
+          T d = (T)0.;
+          bool usedBisection = true;
+
+          for (int i = 0; i < maxIter; i++) {
+
+            if ( func_b == (T)0. || fabs(b - a) < atol ) {
+              return b;
+            }
+
+            T s;
+
+            if ( func_a != func_c && func_b != func_c ) {
+              // Inverse quadratic interpolation
+              s = a * func_b * func_c / ((func_a - func_b) * (func_a - func_c)) +
+                  b * func_a * func_c / ((func_b - func_a) * (func_b - func_c)) +
+                  c * func_a * func_b / ((func_c - func_a) * (func_c - func_b));
+            }
+            else {
+              // Secant method
+              s = b - func_b * (b - a) / (func_b - func_a);
+            }
+
+            // Fall back on bisection whenever the interpolated point is not making fast enough progress
+            if ( (s - ((T)3. * a + b) / (T)4.) * (s - b) > (T)0. ||
+                 (usedBisection && fabs(s - b) >= fabs(b - c) / (T)2.) ||
+                 (!usedBisection && fabs(s - b) >= fabs(c - d) / (T)2.) ||
+                 (usedBisection && fabs(b - c) < atol) ||
+                 (!usedBisection && fabs(c - d) < atol) ) {
+              s = (a + b) / (T)2.;
+              usedBisection = true;
+            }
+            else {
+              usedBisection = false;
+            }
+
+            T func_s = func(s);
+
+            d = c;
+            c = b;
+            func_c = func_b;
+
+            if ( func_a * func_s < (T)0. ) {
+              b = s;
+              func_b = func_s;
+            }
+            else {
+              a = s;
+              func_a = func_s;
+            }
+
+            if ( fabs(func_a) < fabs(func_b) ) {
+              T tmp = a; a = b; b = tmp;
+              tmp = func_a; func_a = func_b; func_b = tmp;
+            }
+
+          }
+
+          WARNING("The Brent iteration did not converge in ", maxIter, " iterations!");
+
+          return b;
+
+        }
+
+
+        /**
+         * @brief Overload of 'brentMethod' taking a std::function
+         * @details Thin wrapper kept so type-erased callables and existing call sites keep working.
+         * Forwards to the generic overload
+         * @tparam T       The template type. Should support basic math operation like addition and division
+         * @param func     The function of which root is to be found
+         * @param start    The start point of the search interval
+         * @param end      The end point of the search interval. Inequality 'start' < 'end' should hold
+         * @param atol     The tolerance for the stopping condition (absolute tolerance). Defaults to 1e-6
+         * @param maxIter  The maximum number of iterations. Defaults to 100
+         * @returns        The root of the function
+         */
+        template <typename T>
+        T brentMethod(std::function<T (T)> func, T start, T end, T atol = 1e-6, int maxIter = 100) {
+
+          return brentMethod<T, std::function<T (T)>&>(func, start, end, atol, maxIter);
+
+        }
+
+
       }
 
     }
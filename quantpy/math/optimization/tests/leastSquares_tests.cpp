@@ -0,0 +1,112 @@
+/**
+ * @file leastSquares_tests.cpp
+ * @brief Definition of tests for nonlinear least-squares solvers
+ * @details Compile in the main quantpy directory with:
+ * > g++ -std=c++17 -mavx -fopenmp -Wall quantpy/math/optimization/tests/leastSquares_tests.cpp -lm -o leastSquares_tests.o
+ * Run with:
+ * > ./leastSquares_tests.o
+ * @author Kasper Rantamäki
+ * @date 2026-08-29
+ */
+
+
+#include <cmath>
+#include <vector>
+
+#include "../leastSquares.hpp"
+#include "../../../cpp/testing.hpp"
+#include "../../../cpp/logging.hpp"
+
+
+#ifndef TEST_TOL
+  #define TEST_TOL 1e-6
+#endif
+
+
+namespace quantpy {
+
+  namespace math {
+
+    namespace optimization {
+
+      namespace leastSquares_tests {
+
+
+        // Test 1
+        bool test_levenbergMarquardt1() {
+
+          // An overdetermined linear fit should converge to the exact generating parameters
+          auto residual = [](const std::vector<double>& params, int i) {
+            double x = 0.1 * (double)i;
+            return params[0] + params[1] * x - (2.5 - 0.8 * x);
+          };
+
+          std::vector<double> foundParams = leastSquares::levenbergMarquardt<double>(residual, 20, { 0., 0. });
+
+          DEBUG("Found parameters: ", foundParams[0], ", ", foundParams[1]);
+
+          return ( fabs(foundParams[0] - 2.5) < TEST_TOL ) && ( fabs(foundParams[1] + 0.8) < TEST_TOL );
+
+        }
+
+
+        // Test 2
+        bool test_levenbergMarquardt2() {
+
+          // Fit an exponential decay to noiseless synthetic observations
+          auto residual = [](const std::vector<double>& params, int i) {
+            double x = 0.25 * (double)i;
+            return params[0] * exp(params[1] * x) - 3. * exp(-0.5 * x);
+          };
+
+          std::vector<double> foundParams = leastSquares::levenbergMarquardt<double>(residual, 30, { 1., -1. });
+
+          DEBUG("Found parameters: ", foundParams[0], ", ", foundParams[1]);
+
+          return ( fabs(foundParams[0] - 3.) < 1e-4 ) && ( fabs(foundParams[1] + 0.5) < 1e-4 );
+
+        }
+
+
+        // Test 3
+        bool test_levenbergMarquardt3() {
+
+          // The Rosenbrock function in least-squares form has its minimum at (1, 1)
+          auto residual = [](const std::vector<double>& params, int i) {
+            if ( i == 0 ) {
+              return 10. * (params[1] - params[0] * params[0]);
+            }
+            return 1. - params[0];
+          };
+
+          std::vector<double> foundParams = leastSquares::levenbergMarquardt<double>(residual, 2, { -1.2, 1. }, 1e-12, 1000);
+
+          DEBUG("Found parameters: ", foundParams[0], ", ", foundParams[1]);
+
+          return ( fabs(foundParams[0] - 1.) < 1e-4 ) && ( fabs(foundParams[1] - 1.) < 1e-4 );
+
+        }
+
+
+      }
+
+    }
+
+  }
+
+}
+
+
+int main() {
+
+  quantpy::cpp::logging::verbosity(3);
+
+  quantpy::cpp::testing::TestSuite leastSquaresTests = quantpy::cpp::testing::TestSuite("leastSquares.hpp");
+
+  leastSquaresTests.addTest(quantpy::math::optimization::leastSquares_tests::test_levenbergMarquardt1);
+  leastSquaresTests.addTest(quantpy::math::optimization::leastSquares_tests::test_levenbergMarquardt2);
+  leastSquaresTests.addTest(quantpy::math::optimization::leastSquares_tests::test_levenbergMarquardt3);
+
+  return (int)leastSquaresTests.runTests();
+
+}
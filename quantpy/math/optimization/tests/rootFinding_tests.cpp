@@ -78,7 +78,83 @@ namespace quantpy {
           DEBUG("Found root: ", foundRoot);
 
           return ( fabs(correctRoot - foundRoot) < TEST_TOL );
-          
+
+        }
+
+
+        // Test 4
+        bool test_newtonRaphson1() {
+
+          auto testFunc = [](double x) {
+            return 2. * x - 5.;
+          };
+
+          auto testDeriv = [](double x) {
+            return 2.;
+          };
+
+          double correctRoot = 2.5;
+          double foundRoot = rootFinding::newtonRaphson<double>(testFunc, testDeriv, 0.);
+
+          DEBUG("Found root: ", foundRoot);
+
+          return ( fabs(correctRoot - foundRoot) < TEST_TOL );
+
+        }
+
+
+        // Test 5
+        bool test_newtonRaphson2() {
+
+          auto testFunc = [](double x) {
+            return exp(0.5 * x) - 5.;
+          };
+
+          auto testDeriv = [](double x) {
+            return 0.5 * exp(0.5 * x);
+          };
+
+          double correctRoot = 3.2188758249;
+          double foundRoot = rootFinding::newtonRaphson<double>(testFunc, testDeriv, 0.);
+
+          DEBUG("Found root: ", foundRoot);
+
+          return ( fabs(correctRoot - foundRoot) < TEST_TOL );
+
+        }
+
+
+        // Test 6
+        bool test_brentMethod1() {
+
+          auto testFunc = [](double x) {
+            return exp(0.5 * x) - 5.;
+          };
+
+          double correctRoot = 3.2188758249;
+          double foundRoot = rootFinding::brentMethod<double>(testFunc, 0., 5.);
+
+          DEBUG("Found root: ", foundRoot);
+
+          return ( fabs(correctRoot - foundRoot) < TEST_TOL );
+
+        }
+
+
+        // Test 7
+        bool test_brentMethod2() {
+
+          auto testFunc = [](double x) {
+            return sqrt(2 * x) - 2.;
+          };
+
+          double correctRoot = 2.;
+          double foundRoot = rootFinding::brentMethod<double>(testFunc, 0., 4.);
+
+          DEBUG("Found root: ", foundRoot);
+
+          return ( fabs(correctRoot - foundRoot) < TEST_TOL );
+
         }
 
 
@@ -100,6 +176,10 @@ int main() {
   rootFindingTests.addTest(quantpy::math::optimization::rootFinding_tests::test_bisectionMethod1);
   rootFindingTests.addTest(quantpy::math::optimization::rootFinding_tests::test_bisectionMethod2);
   rootFindingTests.addTest(quantpy::math::optimization::rootFinding_tests::test_bisectionMethod3);
+  rootFindingTests.addTest(quantpy::math::optimization::rootFinding_tests::test_newtonRaphson1);
+  rootFindingTests.addTest(quantpy::math::optimization::rootFinding_tests::test_newtonRaphson2);
+  rootFindingTests.addTest(quantpy::math::optimization::rootFinding_tests::test_brentMethod1);
+  rootFindingTests.addTest(quantpy::math::optimization::rootFinding_tests::test_brentMethod2);
 
   return (int)rootFindingTests.runTests();
 
@@ -53,7 +53,7 @@ namespace quantpy {
         template <typename T>
         T cdf(T shape, T rate, T x) {
 
-          return (T)1. / tgamma(shape) * special::lowerIncompleteGamma(shape, rate * x);
+          return special::regularizedLowerIncompleteGamma(shape, rate * x);
 
         }
 
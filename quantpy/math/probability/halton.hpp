@@ -0,0 +1,160 @@
+/**
+ * @file halton.hpp
+ * @brief Halton low-discrepancy sequence for quasi-Monte Carlo sampling
+ * @details Low-discrepancy sequences fill the unit hypercube far more evenly than pseudo-random
+ * draws, improving the Monte Carlo convergence rate from \f$ O(n^{-1/2}) \f$ towards
+ * \f$ O(n^{-1}) \f$ for smooth integrands [1]. The Halton sequence forms its d:th coordinate by
+ * reflecting the digits of the point index in the d:th prime base, so like a counter-based
+ * generator any point can be produced directly from its index without per-stream state. Plain
+ * Halton coordinates in high bases are noticeably correlated, so high-dimensional integrands
+ * should concentrate their variance onto the leading dimensions, e.g. with a Brownian bridge
+ * construction for sampled paths.
+ * [1]: P. Glasserman. "Monte Carlo Methods in Financial Engineering", Springer, 2004
+ * @author Kasper Rantamäki
+ * @date 2026-08-29
+ */
+
+#ifndef HALTON_HPP
+#define HALTON_HPP
+
+
+#include <cstdint>
+#include <vector>
+
+#include "../../cpp/logging.hpp"
+
+
+namespace quantpy {
+
+  namespace math {
+
+    namespace probability {
+
+      namespace halton {
+
+
+        /**
+         * @brief The radical inverse of an integer in a given base
+         * @details Reflects the base-b digits of the index around the radix point, i.e. maps the
+         * integer \f$ \sum_k a_k b^k \f$ onto \f$ \sum_k a_k b^{-k-1} \in [0, 1) \f$
+         * @tparam T    The template type. Should be some floating point number type
+         * @param idx   The index whose digits are reflected
+         * @param base  The base in which the digits are taken. Should be at least 2
+         * @returns     The radical inverse on the unit interval
+         */
+        template <typename T>
+        T radicalInverse(uint64_t idx, int base) {
+
+          T inverse = (T)0.;
+          T digitWeight = (T)1. / (T)base;
+
+          while ( idx > 0 ) {
+            inverse += (T)(idx % base) * digitWeight;
+            idx /= base;
+            digitWeight /= (T)base;
+          }
+
+          return inverse;
+
+        }
+
+
+        /**
+         * @brief Multidimensional Halton sequence
+         * @details The d:th coordinate of the i:th point is the radical inverse of i in the d:th
+         * prime base. As a point is computed directly from its index, points can be handed out to
+         * e.g. OpenMP threads by index just like the substreams of the Philox generator, yielding
+         * the same sequence regardless of the number of threads or the execution order. The point
+         * at index zero is skipped internally as it would be the origin in every dimension
+         */
+        class HaltonSequence {
+
+          protected:
+
+            std::vector<int> _bases;  /**< The prime bases, one per dimension */
+
+          public:
+
+            /**
+             * @brief Default constructor
+             * @returns  Uninitialized HaltonSequence object
+             */
+            HaltonSequence() {  }
+
+
+            /**
+             * @brief Main constructor. Sieves the first 'dim' primes for the coordinate bases
+             * @param dim  The dimension of the generated points
+             * @returns    Initialized HaltonSequence object
+             */
+            HaltonSequence(int dim) {
+
+              if ( dim < 1 ) {
+                ERROR("The dimension must be positive! (", dim, " < 1)");
+              }
+
+              this->_bases.reserve(dim);
+
+              int candidate = 2;
+
+              while ( (int)this->_bases.size() < dim ) {
+
+                bool isPrime = true;
+
+                for (int prime : this->_bases) {
+                  if ( prime * prime > candidate ) {
+                    break;
+                  }
+                  if ( candidate % prime == 0 ) {
+                    isPrime = false;
+                    break;
+                  }
+                }
+
+                if ( isPrime ) {
+                  this->_bases.push_back(candidate);
+                }
+
+                candidate++;
+
+              }
+
+            }
+
+
+            /**
+             * @brief Getter for the dimension of the generated points
+             * @returns The dimension of the generated points
+             */
+            int dim() const { return (int)this->_bases.size(); }
+
+
+            /**
+             * @brief Computes the coordinates of the idx:th point of the sequence
+             * @tparam T   The template type. Should be some floating point number type
+             * @param idx  The index of the point
+             * @param out  Pointer to a buffer of at least 'dim' values into which the coordinates are written
+             * @returns    Void. The coordinates are written into the 'out' buffer
+             */
+            template <typename T>
+            void point(uint64_t idx, T* out) const {
+
+              for (int d = 0; d < (int)this->_bases.size(); d++) {
+                out[d] = radicalInverse<T>(idx + 1, this->_bases[d]);
+              }
+
+            }
+
+        };
+
+
+      }
+
+    }
+
+  }
+
+}
+
+
+#endif
@@ -71,8 +71,13 @@ namespace quantpy {
           T half_x = x / (T)2.;
           T half_k = k / (T)2.;
 
+          // The Poisson factor is accumulated by recurrence, as the explicit pow/factorial form
+          // overflows long before the sum terminates
+          T weight = (T)1.;
+
           for (int j = 0; j <= max_j; j++) {
-            sum += (pow(lambda / (T)2., (T)j) / special::factorial(j)) * (special::lowerIncompleteGamma(half_k + j, half_x) / tgamma(half_k + j));
+            sum    += weight * (special::lowerIncompleteGamma(half_k + j, half_x) / tgamma(half_k + j));
+            weight *= (lambda / (T)2.) / (T)(j + 1);
           }
 
 
@@ -81,6 +86,119 @@ namespace quantpy {
         }
 
 
+        /**
+         * @brief Evaluator object for many CDF evaluations of a fixed noncentral chi-squared distribution
+         * @details The free 'cdf' function pays for an incomplete gamma evaluation — itself a series or
+         * quadrature — per term of the Poisson mixture, which makes pricing a strip of CIR bond options
+         * with hundreds of CDF calls prohibitively slow. For a fixed distribution the mixture weights
+         * \f$ w_j = e^{-\lambda / 2} (\lambda / 2)^j / j! \f$ do not depend on the evaluation point, so
+         * the evaluator precomputes them once up to the requested tail mass. Each evaluation then costs
+         * a single regularized lower incomplete gamma call for the leading term, with the higher terms
+         * obtained through the upward recurrence
+         * \f$ P(s + 1, x) = P(s, x) - x^s e^{-x} / \Gamma(s + 1) \f$,
+         * i.e. one multiplication and subtraction per term
+         * @tparam T  The template type. Should be some floating point type
+         */
+        template <typename T>
+        class CdfEvaluator {
+
+          protected:
+
+            T _halfK;                 /**< Half the degrees of freedom */
+            T _lgammaHalfK1;          /**< The precomputed value \f$ \ln \Gamma(k / 2 + 1) \f$ */
+            std::vector<T> _weights;  /**< The precomputed Poisson mixture weights */
+
+          public:
+
+            /**
+             * @brief Main constructor. Precomputes the Poisson mixture weights
+             * @param k         The degrees of freedom
+             * @param lambda    The non-centrality parameter
+             * @param tol       The Poisson tail mass left out of the precomputed weights. Defaults to 1e-12
+             * @param maxTerms  The maximum number of precomputed terms. Defaults to 10000
+             * @returns         Initialized CdfEvaluator object
+             */
+            CdfEvaluator(T k, T lambda, T tol = (T)1e-12, int maxTerms = 10000) {
+
+              if ( k <= (T)0. ) {
+                ERROR("The degrees of freedom needs to be positive! (", k, " <= 0)");
+              }
+
+              if ( lambda < (T)0. ) {
+                ERROR("The non-centrality parameter can not be negative! (", lambda, " < 0)");
+              }
+
+              this->_halfK        = k / (T)2.;
+              this->_lgammaHalfK1 = lgamma(k / (T)2. + (T)1.);
+
+              T halfLambda = lambda / (T)2.;
+              T weight     = exp(-halfLambda);
+              T cumulative = (T)0.;
+
+              for (int j = 0; j < maxTerms; j++) {
+
+                this->_weights.push_back(weight);
+                cumulative += weight;
+
+                if ( (T)1. - cumulative < tol ) {
+                  return;
+                }
+
+                weight *= halfLambda / (T)(j + 1);
+
+              }
+
+              WARNING("The Poisson weights did not reach the requested tail mass in ", maxTerms, " terms!");
+
+            }
+
+
+            /**
+             * @brief Getter for the number of precomputed terms
+             * @returns The number of precomputed terms
+             */
+            int nTerms() const { return (int)this->_weights.size(); }
+
+
+            /**
+             * @brief Evaluates the CDF at the given point
+             * @param x  The point where the CDF is evaluated
+             * @returns  The cumulative density at the point 'x'
+             */
+            T operator() (T x) const {
+
+              if ( x <= (T)0. ) {
+                return (T)0.;
+              }
+
+              T halfX = x / (T)2.;
+
+              // The leading term pays for the full incomplete gamma evaluation once
+              T P = special::regularizedLowerIncompleteGamma<T>(this->_halfK, halfX);
+
+              // The correction subtracted by the upward recurrence at each step
+              T term = exp(this->_halfK * log(halfX) - halfX - this->_lgammaHalfK1);
+
+              T sum = (T)0.;
+
+              for (int j = 0; j < (int)this->_weights.size(); j++) {
+
+                sum += this->_weights[j] * P;
+
+                P -= term;
+                P  = P > (T)0. ? P : (T)0.;
+
+                term *= halfX / (this->_halfK + (T)(j + 1));
+
+              }
+
+              return sum;
+
+            }
+
+        };
+
+
         /**
          * @brief Calculates the raw moments for the given noncentral chi-squared distribution
          * @tparam T     The template type. Should support cmath math operations
@@ -98,12 +216,90 @@ namespace quantpy {
 
 
         /**
-         * 
+         * @brief Fills a caller-provided buffer with samples from a given noncentral chi-squared distribution
+         * @details For more than one degree of freedom the draws are composed as a central chi-squared
+         * with \f$ k - 1 \f$ degrees of freedom plus an independent squared Gaussian shifted by
+         * \f$ \sqrt{\lambda} \f$; below one degree of freedom the Poisson mixture representation
+         * \f$ \chi^2_{k + 2 J} \f$ with \f$ J \sim \mathrm{Poisson}(\lambda / 2) \f$ is used instead.
+         * The distribution objects are constructed once per call, so filling a block amortizes the
+         * setup over all of the draws
+         * @tparam T      The template type. Should be some floating point type
+         * @param k       The degrees of freedom
+         * @param lambda  The non-centrality parameter
+         * @param buffer  Pointer to the buffer into which the samples are written
+         * @param n       The number of observations sampled
+         * @returns       Void. The samples are written into the 'buffer'
+         */
+        template <typename T>
+        void sample(T k, T lambda, T* buffer, int n) {
+
+          if ( n < 0 ) {
+            ERROR("The number of samples can not be negative! (", n, " < 0)");
+          }
+
+          if ( k <= (T)0. ) {
+            ERROR("The degrees of freedom needs to be positive! (", k, " <= 0)");
+          }
+
+          if ( lambda < (T)0. ) {
+            ERROR("The non-centrality parameter can not be negative! (", lambda, " < 0)");
+          }
+
+          // The generator is seeded once per thread and reused across calls as both the construction
+          // of the generator and the entropy read from the random device are expensive
+          static thread_local std::mt19937 generator{std::random_device{}()};
+
+          std::normal_distribution<T> normalDistribution((T)0., (T)1.);
+
+          if ( k > (T)1. ) {
+
+            // A gamma draw with scale two is a central chi-squared draw
+            std::gamma_distribution<T> chiSquared((k - (T)1.) / (T)2., (T)2.);
+
+            T shift = sqrt(lambda);
+
+            for (int i = 0; i < n; i++) {
+              T z = normalDistribution(generator) + shift;
+              buffer[i] = chiSquared(generator) + z * z;
+            }
+
+            return;
+
+          }
+
+          std::poisson_distribution<int> poissonDistribution(lambda / (T)2.);
+
+          for (int i = 0; i < n; i++) {
+            int j = poissonDistribution(generator);
+            std::gamma_distribution<T> chiSquared(k / (T)2. + (T)j, (T)2.);
+            buffer[i] = chiSquared(generator);
+          }
+
+        }
+
+
+        /**
+         * @brief Samples from a given noncentral chi-squared distribution
+         * @tparam T      The template type. Should be some floating point type
+         * @param k       The degrees of freedom
+         * @param lambda  The non-centrality parameter
+         * @param n       The number of observations sampled
+         * @returns       A std::vector object with the samples
          */
-        //template <typename T>
-        //std::vector<T> sample() {
-        //
-        //}
+        template <typename T>
+        std::vector<T> sample(T k, T lambda, int n) {
+
+          if ( n < 0 ) {
+            ERROR("The number of samples can not be negative! (", n, " < 0)");
+          }
+
+          std::vector<T> samples(n);
+
+          sample(k, lambda, samples.data(), n);
+
+          return samples;
+
+        }
 
 
       }
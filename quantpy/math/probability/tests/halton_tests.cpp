@@ -0,0 +1,139 @@
+/**
+ * @file halton_tests.cpp
+ * @brief Definition of tests for the Halton low-discrepancy sequence
+ * @details Compile in the main quantpy directory with:
+ * > g++ -std=c++17 -mavx -fopenmp -Wall quantpy/math/probability/tests/halton_tests.cpp -lm -o halton_tests.o
+ * Run with:
+ * > ./halton_tests.o
+ * @author Kasper Rantamäki
+ * @date 2026-08-29
+ */
+
+
+#include <cmath>
+
+#include "../halton.hpp"
+#include "../normal.hpp"
+#include "../../../cpp/testing.hpp"
+#include "../../../cpp/logging.hpp"
+
+
+#ifndef TEST_TOL
+  #define TEST_TOL 1e-6
+#endif
+
+
+namespace quantpy {
+
+  namespace math {
+
+    namespace probability {
+
+      namespace halton_tests {
+
+
+        // Test 1
+        bool test_radicalInverse1() {
+
+          // The base 2 radical inverses of 1, 2, 3, 4 are 1/2, 1/4, 3/4, 1/8
+          bool passed = true;
+
+          passed = passed && ( fabs(halton::radicalInverse<double>(1, 2) - 0.5) < TEST_TOL );
+          passed = passed && ( fabs(halton::radicalInverse<double>(2, 2) - 0.25) < TEST_TOL );
+          passed = passed && ( fabs(halton::radicalInverse<double>(3, 2) - 0.75) < TEST_TOL );
+          passed = passed && ( fabs(halton::radicalInverse<double>(4, 2) - 0.125) < TEST_TOL );
+
+          return passed;
+
+        }
+
+
+        // Test 2
+        bool test_radicalInverse2() {
+
+          // The base 3 radical inverses of 1, 2, 3 are 1/3, 2/3, 1/9
+          bool passed = true;
+
+          passed = passed && ( fabs(halton::radicalInverse<double>(1, 3) - 1. / 3.) < TEST_TOL );
+          passed = passed && ( fabs(halton::radicalInverse<double>(2, 3) - 2. / 3.) < TEST_TOL );
+          passed = passed && ( fabs(halton::radicalInverse<double>(3, 3) - 1. / 9.) < TEST_TOL );
+
+          return passed;
+
+        }
+
+
+        // Test 3
+        bool test_point1() {
+
+          halton::HaltonSequence sequence = halton::HaltonSequence(5);
+
+          double point[5];
+
+          bool passed = ( sequence.dim() == 5 );
+
+          for (int i = 0; i < 1000; i++) {
+            sequence.point<double>(i, point);
+
+            for (int d = 0; d < 5; d++) {
+              passed = passed && ( point[d] > 0. && point[d] < 1. );
+            }
+          }
+
+          return passed;
+
+        }
+
+
+        // Test 4
+        bool test_uniformity1() {
+
+          halton::HaltonSequence sequence = halton::HaltonSequence(2);
+
+          double point[2];
+          double sums[2] = {0., 0.};
+
+          int n = 10000;
+
+          for (int i = 0; i < n; i++) {
+            sequence.point<double>(i, point);
+            sums[0] += point[0];
+            sums[1] += point[1];
+          }
+
+          DEBUG("Found sample means: ", sums[0] / n, " and ", sums[1] / n);
+
+          // The low-discrepancy points should have their sample mean very close to 1/2
+          bool passed = true;
+
+          passed = passed && ( fabs(sums[0] / n - 0.5) < 1e-3 );
+          passed = passed && ( fabs(sums[1] / n - 0.5) < 1e-3 );
+
+          return passed;
+
+        }
+
+
+      }
+
+    }
+
+  }
+
+}
+
+
+int main() {
+
+  quantpy::cpp::logging::verbosity(3);
+
+  quantpy::cpp::testing::TestSuite haltonTests = quantpy::cpp::testing::TestSuite("halton.hpp");
+
+  haltonTests.addTest(quantpy::math::probability::halton_tests::test_radicalInverse1);
+  haltonTests.addTest(quantpy::math::probability::halton_tests::test_radicalInverse2);
+  haltonTests.addTest(quantpy::math::probability::halton_tests::test_point1);
+  haltonTests.addTest(quantpy::math::probability::halton_tests::test_uniformity1);
+
+  return (int)haltonTests.runTests();
+
+}
@@ -0,0 +1,184 @@
+/**
+ * @file noncentralChiSquared_tests.cpp
+ * @brief Definition of tests for the noncentral chi-squared distribution functions
+ * @details Compile in the main quantpy directory with:
+ * > g++ -std=c++17 -mavx -fopenmp -Wall quantpy/math/probability/tests/noncentralChiSquared_tests.cpp -lm -o noncentralChiSquared_tests.o
+ * Run with:
+ * > ./noncentralChiSquared_tests.o
+ * @author Kasper Rantamäki
+ * @date 2026-08-29
+ */
+
+#include <cmath>
+
+#include "../noncentralChiSquared.hpp"
+#include "../../../cpp/testing.hpp"
+#include "../../../cpp/logging.hpp"
+
+
+#ifndef TEST_TOL
+  #define TEST_TOL 1e-8
+#endif
+
+
+namespace quantpy {
+
+  namespace math {
+
+    namespace probability {
+
+      namespace noncentralChiSquared_tests {
+
+
+        // Test 1
+        bool test_cdfEvaluator1() {
+
+          // Reference values computed with an independent high precision implementation. Note that
+          // the evaluator is considerably more accurate than the quadrature limited free 'cdf'
+          noncentralChiSquared::CdfEvaluator evaluator = noncentralChiSquared::CdfEvaluator<double>(4., 2.5);
+
+          double points[6]      = { 0.5, 1., 2., 5., 10., 20. };
+          double correctCdfs[6] = { 0.0083966727, 0.0314050964, 0.1090741908,
+                                    0.4333134653, 0.8182512341, 0.9904720207 };
+
+          bool passed = true;
+
+          for (int i = 0; i < 6; i++) {
+
+            double foundCdf = evaluator(points[i]);
+
+            DEBUG("Found CDF: ", foundCdf, " (correct: ", correctCdfs[i], ")");
+
+            passed = passed && ( fabs(foundCdf - correctCdfs[i]) < TEST_TOL );
+
+          }
+
+          return passed;
+
+        }
+
+
+        // Test 2
+        bool test_cdfEvaluator2() {
+
+          // With a vanishing non-centrality parameter the distribution reduces to the chi-squared
+          // distribution, i.e. the regularized lower incomplete gamma
+          noncentralChiSquared::CdfEvaluator evaluator = noncentralChiSquared::CdfEvaluator<double>(3., 0.);
+
+          bool passed = true;
+
+          for (double x : { 0.5, 2., 5., 10. }) {
+
+            double correctCdf = special::regularizedLowerIncompleteGamma<double>(1.5, x / 2.);
+            double foundCdf   = evaluator(x);
+
+            DEBUG("Found CDF: ", foundCdf, " (correct: ", correctCdf, ")");
+
+            passed = passed && ( fabs(foundCdf - correctCdf) < TEST_TOL );
+
+          }
+
+          return passed;
+
+        }
+
+
+        // Test 3
+        bool test_cdfEvaluator3() {
+
+          // The CDF should be monotonically increasing from zero towards one
+          noncentralChiSquared::CdfEvaluator evaluator = noncentralChiSquared::CdfEvaluator<double>(5., 8.);
+
+          bool passed = ( evaluator(0.) == 0. );
+          double previousCdf = 0.;
+
+          for (int i = 1; i <= 50; i++) {
+
+            double foundCdf = evaluator(2. * (double)i);
+
+            passed = passed && ( foundCdf >= previousCdf );
+            previousCdf = foundCdf;
+
+          }
+
+          return passed && ( fabs(previousCdf - 1.) < TEST_TOL );
+
+        }
+
+
+        // Test 4
+        bool test_sample1() {
+
+          // The sample moments should match the known mean k + lambda and variance 2(k + 2 lambda)
+          int n = 200000;
+          std::vector<double> samples = noncentralChiSquared::sample<double>(4., 2.5, n);
+
+          double mean = 0.;
+          double var  = 0.;
+
+          for (int i = 0; i < n; i++) {
+            mean += samples[i];
+          }
+
+          mean /= (double)n;
+
+          for (int i = 0; i < n; i++) {
+            var += (samples[i] - mean) * (samples[i] - mean);
+          }
+
+          var /= (double)(n - 1);
+
+          DEBUG("Found mean: ", mean, " (correct: 6.5)");
+          DEBUG("Found variance: ", var, " (correct: 18)");
+
+          return ( fabs(mean - 6.5) < 0.1 ) && ( fabs(var - 18.) < 0.5 );
+
+        }
+
+
+        // Test 5
+        bool test_sample2() {
+
+          // Fractional degrees of freedom below one exercise the Poisson mixture branch
+          int n = 200000;
+          std::vector<double> samples = noncentralChiSquared::sample<double>(0.5, 3., n);
+
+          double mean = 0.;
+
+          for (int i = 0; i < n; i++) {
+            mean += samples[i];
+          }
+
+          mean /= (double)n;
+
+          DEBUG("Found mean: ", mean, " (correct: 3.5)");
+
+          return fabs(mean - 3.5) < 0.1;
+
+        }
+
+
+      }
+
+    }
+
+  }
+
+}
+
+
+int main() {
+
+  quantpy::cpp::logging::verbosity(3);
+
+  quantpy::cpp::testing::TestSuite noncentralChiSquaredTests = quantpy::cpp::testing::TestSuite("noncentralChiSquared.hpp");
+
+  noncentralChiSquaredTests.addTest(quantpy::math::probability::noncentralChiSquared_tests::test_cdfEvaluator1);
+  noncentralChiSquaredTests.addTest(quantpy::math::probability::noncentralChiSquared_tests::test_cdfEvaluator2);
+  noncentralChiSquaredTests.addTest(quantpy::math::probability::noncentralChiSquared_tests::test_cdfEvaluator3);
+  noncentralChiSquaredTests.addTest(quantpy::math::probability::noncentralChiSquared_tests::test_sample1);
+  noncentralChiSquaredTests.addTest(quantpy::math::probability::noncentralChiSquared_tests::test_sample2);
+
+  return (int)noncentralChiSquaredTests.runTests();
+
+}
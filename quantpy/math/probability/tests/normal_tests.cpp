@@ -109,6 +109,145 @@ namespace quantpy {
         } 
 
 
+        // Test 7
+        bool test_simdPdf1() {
+
+          typename quantpy::cpp::simd::simd<double>::data x = {-1.5, -0.5, 0.5, 1.5};
+          typename quantpy::cpp::simd::simd<double>::data foundPDF = normal::pdf<double>(0., 1., x);
+
+          bool passed = true;
+          for (int lane = 0; lane < 4; lane++) {
+            DEBUG("Found PDF: ", foundPDF[lane]);
+            passed = passed && ( fabs(normal::pdf<double>(0., 1., x[lane]) - foundPDF[lane]) < TEST_TOL );
+          }
+
+          return passed;
+
+        }
+
+
+        // Test 8
+        bool test_simdCdf1() {
+
+          typename quantpy::cpp::simd::simd<double>::data x = {-1.5, -0.5, 0.5, 1.5};
+          typename quantpy::cpp::simd::simd<double>::data foundCDF = normal::cdf<double>(1., sqrt(2), x);
+
+          bool passed = true;
+          for (int lane = 0; lane < 4; lane++) {
+            DEBUG("Found CDF: ", foundCDF[lane]);
+            passed = passed && ( fabs(normal::cdf<double>(1., sqrt(2), x[lane]) - foundCDF[lane]) < TEST_TOL );
+          }
+
+          return passed;
+
+        }
+
+
+        // Test 9
+        bool test_sampler1() {
+
+          normal::NormalSampler<double> sampler = normal::NormalSampler<double>(1., 2., 42);
+
+          double samples[10000];
+          sampler.fill(samples, 10000);
+
+          double sum = 0.;
+          for (int i = 0; i < 10000; i++) {
+            sum += samples[i];
+          }
+          double sampleMean = sum / 10000.;
+
+          DEBUG("Found sample mean: ", sampleMean);
+
+          return ( fabs(sampleMean - 1.) < 0.1 );
+
+        }
+
+
+        // Test 10
+        bool test_sampler2() {
+
+          normal::NormalSampler<double> sampler1 = normal::NormalSampler<double>(0., 1., 42);
+          normal::NormalSampler<double> sampler2 = normal::NormalSampler<double>(0., 1., 42);
+
+          bool passed = true;
+          for (int i = 0; i < 100; i++) {
+            passed = passed && ( sampler1() == sampler2() );
+          }
+
+          return passed;
+
+        }
+
+
+        // Test 11
+        bool test_quantile1() {
+
+          // Round-trip through the cumulative density function
+          bool passed = true;
+
+          for (double p : {0.001, 0.05, 0.5, 0.9, 0.999}) {
+            double foundP = normal::cdf<double>(0., 1., normal::quantile<double>(0., 1., p));
+            DEBUG("Found probability: ", foundP);
+            passed = passed && ( fabs(foundP - p) < TEST_TOL );
+          }
+
+          return passed;
+
+        }
+
+
+        // Test 12
+        bool test_quantile2() {
+
+          double correctQuantile = 1.959963985;
+          double foundQuantile = normal::quantile<double>(0., 1., 0.975);
+
+          DEBUG("Found quantile: ", foundQuantile);
+
+          return ( fabs(correctQuantile - foundQuantile) < TEST_TOL );
+
+        }
+
+
+        // Test 13
+        bool test_fastCdf1() {
+
+          // The fast approximation should agree with the erf based reference path well inside its
+          // stated accuracy across the central region and the tails
+          bool passed = true;
+
+          for (double x = -8.; x <= 8.; x += 0.25) {
+
+            double referenceCDF = normal::cdf<double>(1., sqrt(2), x);
+            double foundCDF = normal::fastCdf<double>(1., sqrt(2), x);
+
+            passed = passed && ( fabs(referenceCDF - foundCDF) < 1e-10 );
+
+          }
+
+          return passed;
+
+        }
+
+
+        // Test 14
+        bool test_simdFastCdf1() {
+
+          typename quantpy::cpp::simd::simd<double>::data x = {-1.5, -0.5, 0.5, 1.5};
+          typename quantpy::cpp::simd::simd<double>::data foundCDF = normal::fastCdf<double>(1., sqrt(2), x);
+
+          bool passed = true;
+          for (int lane = 0; lane < 4; lane++) {
+            DEBUG("Found CDF: ", foundCDF[lane]);
+            passed = passed && ( fabs(normal::fastCdf<double>(1., sqrt(2), x[lane]) - foundCDF[lane]) < 1e-14 );
+          }
+
+          return passed;
+
+        }
+
+
       }
 
     }
@@ -130,6 +269,14 @@ int main() {
   normalTests.addTest(quantpy::math::probability::normal_tests::test_cdf2);
   normalTests.addTest(quantpy::math::probability::normal_tests::test_moment1);
   normalTests.addTest(quantpy::math::probability::normal_tests::test_moment2);
+  normalTests.addTest(quantpy::math::probability::normal_tests::test_simdPdf1);
+  normalTests.addTest(quantpy::math::probability::normal_tests::test_simdCdf1);
+  normalTests.addTest(quantpy::math::probability::normal_tests::test_sampler1);
+  normalTests.addTest(quantpy::math::probability::normal_tests::test_sampler2);
+  normalTests.addTest(quantpy::math::probability::normal_tests::test_quantile1);
+  normalTests.addTest(quantpy::math::probability::normal_tests::test_quantile2);
+  normalTests.addTest(quantpy::math::probability::normal_tests::test_fastCdf1);
+  normalTests.addTest(quantpy::math::probability::normal_tests::test_simdFastCdf1);
 
   return (int)normalTests.runTests();
 
@@ -0,0 +1,130 @@
+/**
+ * @file philox_tests.cpp
+ * @brief Definition of tests for the counter-based Philox generator
+ * @details Compile in the main quantpy directory with:
+ * > g++ -std=c++17 -mavx -fopenmp -Wall quantpy/math/probability/tests/philox_tests.cpp -lm -o philox_tests.o
+ * Run with:
+ * > ./philox_tests.o
+ * @author Kasper Rantamäki
+ * @date 2026-08-29
+ */
+
+
+#include <cmath>
+#include <random>
+
+#include "../philox.hpp"
+#include "../../../cpp/testing.hpp"
+#include "../../../cpp/logging.hpp"
+
+
+#ifndef TEST_TOL
+  #define TEST_TOL 1e-6
+#endif
+
+
+namespace quantpy {
+
+  namespace math {
+
+    namespace probability {
+
+      namespace philox_tests {
+
+
+        // Test 1
+        bool test_determinism1() {
+
+          philox::Philox generator1 = philox::Philox(42, 7);
+          philox::Philox generator2 = philox::Philox(42, 7);
+
+          bool passed = true;
+          for (int i = 0; i < 100; i++) {
+            passed = passed && ( generator1() == generator2() );
+          }
+
+          return passed;
+
+        }
+
+
+        // Test 2
+        bool test_streamIndependence1() {
+
+          philox::Philox generator1 = philox::Philox(42, 0);
+          philox::Philox generator2 = philox::Philox(42, 1);
+
+          int countEqual = 0;
+          for (int i = 0; i < 100; i++) {
+            if ( generator1() == generator2() ) {
+              countEqual++;
+            }
+          }
+
+          DEBUG("Found equal count: ", countEqual);
+
+          return ( countEqual == 0 );
+
+        }
+
+
+        // Test 3
+        bool test_uniform1() {
+
+          philox::Philox generator = philox::Philox(42, 0);
+
+          double sum = 0.;
+          for (int i = 0; i < 10000; i++) {
+            sum += generator.uniform<double>();
+          }
+          double sampleMean = sum / 10000.;
+
+          DEBUG("Found sample mean: ", sampleMean);
+
+          return ( fabs(sampleMean - 0.5) < 0.01 );
+
+        }
+
+
+        // Test 4
+        bool test_normalDistribution1() {
+
+          philox::Philox generator = philox::Philox(42, 0);
+          std::normal_distribution<double> distribution(1., 2.);
+
+          double sum = 0.;
+          for (int i = 0; i < 10000; i++) {
+            sum += distribution(generator);
+          }
+          double sampleMean = sum / 10000.;
+
+          DEBUG("Found sample mean: ", sampleMean);
+
+          return ( fabs(sampleMean - 1.) < 0.1 );
+
+        }
+
+
+      }
+
+    }
+
+  }
+
+}
+
+
+int main() {
+
+  quantpy::cpp::logging::verbosity(3);
+
+  quantpy::cpp::testing::TestSuite philoxTests = quantpy::cpp::testing::TestSuite("philox.hpp");
+
+  philoxTests.addTest(quantpy::math::probability::philox_tests::test_determinism1);
+  philoxTests.addTest(quantpy::math::probability::philox_tests::test_streamIndependence1);
+  philoxTests.addTest(quantpy::math::probability::philox_tests::test_uniform1);
+  philoxTests.addTest(quantpy::math::probability::philox_tests::test_normalDistribution1);
+
+  return (int)philoxTests.runTests();
+
+}
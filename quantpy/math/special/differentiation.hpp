@@ -2,6 +2,9 @@
  * @file differentiation.hpp
  * @brief Collection of finite difference functions for numerically evaluating the derivative
  * at a given point
+ * @details The callables are taken as generic template parameters, so lambdas inline into the
+ * stencils without the indirect call a std::function would force. Overloads taking std::function
+ * are kept as thin wrappers for type-erased callables and existing call sites
  * @author Kasper Rantamäki
  * @date 2026-01-16
  */
@@ -32,6 +35,23 @@ namespace quantpy {
 
         /**
          * @brief The first-order forward difference evaluated at point 'x'. Has an error of order \f$ o(h) \f$.
+         * @tparam T     The template type. Should support basic math operation like addition and division
+         * @tparam Func  The callable type. Should map T to T
+         * @param func   The function of which derivative is approximated
+         * @param x      The point at which the derivative is evaluated
+         * @param h      The finite difference. Defaults to 1e-6
+         * @returns      The approximated first-order derivative at the given point
+         */
+        template <typename T, typename Func>
+        T firstForwardDiff(Func&& func, T x, T h = DEFAULT_DIFF) {
+
+          return (func(x + h) - func(x)) / h;
+
+        }
+
+
+        /**
+         * @brief Overload of 'firstForwardDiff' taking a std::function
          * @tparam T    The template type. Should support basic math operation like addition and division
          * @param func  The function of which derivative is approximated
          * @param x     The point at which the derivative is evaluated
@@ -41,13 +61,30 @@ namespace quantpy {
         template <typename T>
         T firstForwardDiff(std::function<T (T)> func, T x, T h = DEFAULT_DIFF) {
 
-          return (func(x + h) - func(x)) / h;
+          return firstForwardDiff<T, std::function<T (T)>&>(func, x, h);
 
         }
 
 
         /**
          * @brief The first-order backward difference evaluated at point 'x'. Has an error of order \f$ o(h) \f$.
+         * @tparam T     The template type. Should support basic math operation like addition and division
+         * @tparam Func  The callable type. Should map T to T
+         * @param func   The function of which derivative is approximated
+         * @param x      The point at which the derivative is evaluated
+         * @param h      The finite difference. Defaults to 1e-6
+         * @returns      The approximated first-order derivative at the given point
+         */
+        template <typename T, typename Func>
+        T firstBackwardDiff(Func&& func, T x, T h = DEFAULT_DIFF) {
+
+          return (func(x) - func(x - h)) / h;
+
+        }
+
+
+        /**
+         * @brief Overload of 'firstBackwardDiff' taking a std::function
          * @tparam T    The template type. Should support basic math operation like addition and division
          * @param func  The function of which derivative is approximated
          * @param x     The point at which the derivative is evaluated
@@ -57,13 +94,30 @@ namespace quantpy {
         template <typename T>
         T firstBackwardDiff(std::function<T (T)> func, T x, T h = DEFAULT_DIFF) {
 
-          return (func(x) - func(x - h)) / h;
+          return firstBackwardDiff<T, std::function<T (T)>&>(func, x, h);
 
         }
 
 
         /**
          * @brief The first-order central difference evaluated at point 'x'. Has an error of order \f$ o(h^2) \f$.
+         * @tparam T     The template type. Should support basic math operation like addition and division
+         * @tparam Func  The callable type. Should map T to T
+         * @param func   The function of which derivative is approximated
+         * @param x      The point at which the derivative is evaluated
+         * @param h      The finite difference. Defaults to 1e-6
+         * @returns      The approximated first-order derivative at the given point
+         */
+        template <typename T, typename Func>
+        T firstCentralDiff(Func&& func, T x, T h = DEFAULT_DIFF) {
+
+          return (func(x + h / (T)2.) - func(x - h / (T)2.)) / h;
+
+        }
+
+
+        /**
+         * @brief Overload of 'firstCentralDiff' taking a std::function
          * @tparam T    The template type. Should support basic math operation like addition and division
          * @param func  The function of which derivative is approximated
          * @param x     The point at which the derivative is evaluated
@@ -73,13 +127,30 @@ namespace quantpy {
         template <typename T>
         T firstCentralDiff(std::function<T (T)> func, T x, T h = DEFAULT_DIFF) {
 
-          return (func(x + h / (T)2.) - func(x - h / (T)2.)) / h;
+          return firstCentralDiff<T, std::function<T (T)>&>(func, x, h);
 
         }
 
 
         /**
          * @brief The second-order forward difference evaluated at point 'x'
+         * @tparam T     The template type. Should support basic math operation like addition and division
+         * @tparam Func  The callable type. Should map T to T
+         * @param func   The function of which derivative is approximated
+         * @param x      The point at which the derivative is evaluated
+         * @param h      The finite difference. Defaults to 1e-6
+         * @returns      The approximated second-order derivative at the given point
+         */
+        template <typename T, typename Func>
+        T secondForwardDiff(Func&& func, T x, T h = DEFAULT_DIFF) {
+
+          return (func(x + (T)2. * h) - (T)2. * func(x + h) + func(x)) / (h * h);
+
+        }
+
+
+        /**
+         * @brief Overload of 'secondForwardDiff' taking a std::function
          * @tparam T    The template type. Should support basic math operation like addition and division
          * @param func  The function of which derivative is approximated
          * @param x     The point at which the derivative is evaluated
@@ -89,13 +160,30 @@ namespace quantpy {
         template <typename T>
         T secondForwardDiff(std::function<T (T)> func, T x, T h = DEFAULT_DIFF) {
 
-          return (func(x + (T)2. * h) - (T)2. * func(x + h) + func(x)) / (h * h);
+          return secondForwardDiff<T, std::function<T (T)>&>(func, x, h);
 
         }
 
 
         /**
          * @brief The second-order backward difference evaluated at point 'x'
+         * @tparam T     The template type. Should support basic math operation like addition and division
+         * @tparam Func  The callable type. Should map T to T
+         * @param func   The function of which derivative is approximated
+         * @param x      The point at which the derivative is evaluated
+         * @param h      The finite difference. Defaults to 1e-6
+         * @returns      The approximated second-order derivative at the given point
+         */
+        template <typename T, typename Func>
+        T secondBackwardDiff(Func&& func, T x, T h = DEFAULT_DIFF) {
+
+          return (func(x) + func(x - (T)2. * h) - (T)2. * func(x - h)) / (h * h);
+
+        }
+
+
+        /**
+         * @brief Overload of 'secondBackwardDiff' taking a std::function
          * @tparam T    The template type. Should support basic math operation like addition and division
          * @param func  The function of which derivative is approximated
          * @param x     The point at which the derivative is evaluated
@@ -105,13 +193,30 @@ namespace quantpy {
         template <typename T>
         T secondBackwardDiff(std::function<T (T)> func, T x, T h = DEFAULT_DIFF) {
 
-          return (func(x) + func(x - (T)2. * h) - (T)2. * func(x - h)) / (h * h);
+          return secondBackwardDiff<T, std::function<T (T)>&>(func, x, h);
 
         }
 
 
         /**
          * @brief The second-order central difference evaluated at point 'x'
+         * @tparam T     The template type. Should support basic math operation like addition and division
+         * @tparam Func  The callable type. Should map T to T
+         * @param func   The function of which derivative is approximated
+         * @param x      The point at which the derivative is evaluated
+         * @param h      The finite difference. Defaults to 1e-6
+         * @returns      The approximated second-order derivative at the given point
+         */
+        template <typename T, typename Func>
+        T secondCentralDiff(Func&& func, T x, T h = DEFAULT_DIFF) {
+
+          return (func(x + h) - (T)2. * func(x) + func(x - h)) / (h * h);
+
+        }
+
+
+        /**
+         * @brief Overload of 'secondCentralDiff' taking a std::function
          * @tparam T    The template type. Should support basic math operation like addition and division
          * @param func  The function of which derivative is approximated
          * @param x     The point at which the derivative is evaluated
@@ -121,22 +226,23 @@ namespace quantpy {
         template <typename T>
         T secondCentralDiff(std::function<T (T)> func, T x, T h = DEFAULT_DIFF) {
 
-          return (func(x + h) - (T)2. * func(x) + func(x - h)) / (h * h);
+          return secondCentralDiff<T, std::function<T (T)>&>(func, x, h);
 
         }
 
 
         /**
          * @brief The nth-order forward difference evaluated at point 'x'
-         * @tparam T    The template type. Should support basic math operation like addition and division
-         * @param func  The function of which derivative is approximated
-         * @param n     The order of the derivative
-         * @param x     The point at which the derivative is evaluated
-         * @param h     The finite difference. Defaults to 1e-6
-         * @returns     The approximated nth-order derivative at the given point
+         * @tparam T     The template type. Should support basic math operation like addition and division
+         * @tparam Func  The callable type. Should map T to T
+         * @param func   The function of which derivative is approximated
+         * @param n      The order of the derivative
+         * @param x      The point at which the derivative is evaluated
+         * @param h      The finite difference. Defaults to 1e-6
+         * @returns      The approximated nth-order derivative at the given point
          */
-        template <typename T>
-        T nthForwardDiff(std::function<T (T)> func, int n, T x, T h = DEFAULT_DIFF) {
+        template <typename T, typename Func>
+        T nthForwardDiff(Func&& func, int n, T x, T h = DEFAULT_DIFF) {
 
           if ( n < 1 ) {
             ERROR("The order of the derivative has to be at least 1! (", n, " < 1)");
@@ -154,7 +260,7 @@ namespace quantpy {
 
 
         /**
-         * @brief The nth-order backward difference evaluated at point 'x'
+         * @brief Overload of 'nthForwardDiff' taking a std::function
          * @tparam T    The template type. Should support basic math operation like addition and division
          * @param func  The function of which derivative is approximated
          * @param n     The order of the derivative
@@ -163,7 +269,25 @@ namespace quantpy {
          * @returns     The approximated nth-order derivative at the given point
          */
         template <typename T>
-        T nthBackwardDiff(std::function<T (T)> func, int n, T x, T h = DEFAULT_DIFF) {
+        T nthForwardDiff(std::function<T (T)> func, int n, T x, T h = DEFAULT_DIFF) {
+
+          return nthForwardDiff<T, std::function<T (T)>&>(func, n, x, h);
+
+        }
+
+
+        /**
+         * @brief The nth-order backward difference evaluated at point 'x'
+         * @tparam T     The template type. Should support basic math operation like addition and division
+         * @tparam Func  The callable type. Should map T to T
+         * @param func   The function of which derivative is approximated
+         * @param n      The order of the derivative
+         * @param x      The point at which the derivative is evaluated
+         * @param h      The finite difference. Defaults to 1e-6
+         * @returns      The approximated nth-order derivative at the given point
+         */
+        template <typename T, typename Func>
+        T nthBackwardDiff(Func&& func, int n, T x, T h = DEFAULT_DIFF) {
 
           if ( n < 1 ) {
             ERROR("The order of the derivative has to be at least 1! (", n, " < 1)");
@@ -181,7 +305,7 @@ namespace quantpy {
 
 
         /**
-         * @brief The nth-order central difference evaluated at point 'x'
+         * @brief Overload of 'nthBackwardDiff' taking a std::function
          * @tparam T    The template type. Should support basic math operation like addition and division
          * @param func  The function of which derivative is approximated
          * @param n     The order of the derivative
@@ -190,7 +314,25 @@ namespace quantpy {
          * @returns     The approximated nth-order derivative at the given point
          */
         template <typename T>
-        T nthCentralDiff(std::function<T (T)> func, int n, T x, T h = DEFAULT_DIFF) {
+        T nthBackwardDiff(std::function<T (T)> func, int n, T x, T h = DEFAULT_DIFF) {
+
+          return nthBackwardDiff<T, std::function<T (T)>&>(func, n, x, h);
+
+        }
+
+
+        /**
+         * @brief The nth-order central difference evaluated at point 'x'
+         * @tparam T     The template type. Should support basic math operation like addition and division
+         * @tparam Func  The callable type. Should map T to T
+         * @param func   The function of which derivative is approximated
+         * @param n      The order of the derivative
+         * @param x      The point at which the derivative is evaluated
+         * @param h      The finite difference. Defaults to 1e-6
+         * @returns      The approximated nth-order derivative at the given point
+         */
+        template <typename T, typename Func>
+        T nthCentralDiff(Func&& func, int n, T x, T h = DEFAULT_DIFF) {
 
           if ( n < 1 ) {
             ERROR("The order of the derivative has to be at least 1! (", n, " < 1)");
@@ -207,6 +349,23 @@ namespace quantpy {
         }
 
 
+        /**
+         * @brief Overload of 'nthCentralDiff' taking a std::function
+         * @tparam T    The template type. Should support basic math operation like addition and division
+         * @param func  The function of which derivative is approximated
+         * @param n     The order of the derivative
+         * @param x     The point at which the derivative is evaluated
+         * @param h     The finite difference. Defaults to 1e-6
+         * @returns     The approximated nth-order derivative at the given point
+         */
+        template <typename T>
+        T nthCentralDiff(std::function<T (T)> func, int n, T x, T h = DEFAULT_DIFF) {
+
+          return nthCentralDiff<T, std::function<T (T)>&>(func, n, x, h);
+
+        }
+
+
       }
 
     }
@@ -216,4 +375,4 @@ namespace quantpy {
 }
 
 
-#endif
\ No newline at end of file
+#endif
@@ -19,8 +19,33 @@ namespace quantpy {
 
     namespace special {
 
+      /**
+       * @brief Lookup table of factorials. To be read through 'factorial'
+       * @details 20! is the largest factorial representable exactly in both 64-bit integers and doubles
+       */
+      constexpr double __FACTORIAL_TABLE[21] = {
+        1., 1., 2., 6., 24., 120., 720., 5040., 40320., 362880., 3628800.,
+        39916800., 479001600., 6227020800., 87178291200., 1307674368000.,
+        20922789888000., 355687428096000., 6402373705728000.,
+        121645100408832000., 2432902008176640000.
+      };
+
+
+      /**
+       * @brief Lookup table of double factorials. To be read through 'doubleFactorial'
+       */
+      constexpr double __DOUBLE_FACTORIAL_TABLE[21] = {
+        1., 1., 2., 3., 8., 15., 48., 105., 384., 945., 3840., 10395., 46080.,
+        135135., 645120., 2027025., 10321920., 34459425., 185794560.,
+        654729075., 3715891200.
+      };
+
+
       /**
        * @brief Factorial function
+       * @details Small arguments — which cover essentially every call site, e.g. the series terms in
+       * the probability distributions — are read from a lookup table; larger ones fall back on the
+       * product loop
        * @tparam T    The template type. Should be some integer type
        * @param n     The non-negative integer for which the factorial is evaluated
        * @returns     The factorial of argument 'n'
@@ -32,6 +57,10 @@ namespace quantpy {
           ERROR("The integer must be non-negative! (", n, " < 0)");
         }
 
+        if ( n <= 20 ) {
+          return (T)__FACTORIAL_TABLE[(int)n];
+        }
+
         T fact = n;
 
         for (T i = n - 1; i > 0; i--) {
@@ -45,7 +74,8 @@ namespace quantpy {
 
       /**
        * @brief Double factorial function
-       * @details The double factorial is the product of integers with the same parity as 'n' up to 'n'
+       * @details The double factorial is the product of integers with the same parity as 'n' up to 'n'.
+       * Small arguments are read from a lookup table; larger ones fall back on the product loop
        * @tparam T    The template type. Should be some integer type
        * @param n     The non-negative integer for which the double factorial is evaluated
        * @returns     The double factorial of argument 'n'
@@ -57,6 +87,10 @@ namespace quantpy {
           ERROR("The integer must be non-negative! (", n, " < 0)");
         }
 
+        if ( n <= 20 ) {
+          return (T)__DOUBLE_FACTORIAL_TABLE[(int)n];
+        }
+
         T fact = n;
 
         for (T i = n - 2; i > 0; i -= 2) {
@@ -82,11 +116,25 @@ namespace quantpy {
       template <typename T>
       T pochhammer(T z, T b) {
 
-        if ( a == (T)0. ) {
+        if ( b == (T)0. ) {
           return (T)1.;
-        } 
+        }
+
+        // For small integer counts the rising factorial is cheaper and more accurate as a direct
+        // product than as the ratio of two gamma evaluations
+        if ( b > (T)0. && b <= (T)20. && b == (T)(int)b ) {
+
+          T product = z;
+
+          for (int i = 1; i < (int)b; i++) {
+            product *= z + (T)i;
+          }
+
+          return product;
+
+        }
 
-        return tgamma(z + a) / tgamma(z);
+        return tgamma(z + b) / tgamma(z);
 
       }
 
@@ -31,22 +31,35 @@ namespace quantpy {
          * @brief Confluent hypergeometric limit function 0F1
          * @details The confluent hypergeometric is defined by the infinite sum \f$ 0F1(;b,z) = \sum_{k=0}^{\infty} \frac{z^k}{(b)_k k!} \f$.
          * The sum doesn't have a formulaic expression. However, it can be assumed to converge quite rapidly.
-         * 
+         * Consecutive terms differ by the factor \f$ z / ((b + k)(k + 1)) \f$, so the sum is evaluated
+         * as an incremental product — one multiply-divide per term instead of a pow, pochhammer and
+         * factorial evaluation each — and terminated as soon as the terms stop contributing at the
+         * requested relative tolerance.
+         *
          * The Bessel function can be represented via confluent hypergeometric limit function as shown in Example 3.3.5 in [1].
          * [1]: M. Petkovšek H. Wilf, D. Zeilberger, “A = B,” A K Peters Ltd, ISBN 1-56881-063-6, 1996
          * @tparam T  The template type. Should be some floating point type
          * @param z      The point where the sum is evaluated
          * @param b      The sum parameter
          * @param max_k  The termination point for the sum. Defaults to 100
+         * @param tol    The relative tolerance at which the sum is terminated. Defaults to 1e-15
          * @returns      The value of the confluent hypergeometric limit function
          */
         template <typename T>
-        T hyp0F1(T z, T b, int max_k = MAX_K) {
+        T hyp0F1(T z, T b, int max_k = MAX_K, T tol = (T)1e-15) {
 
-          T sum = (T)0.;
+          T term = (T)1.;
+          T sum  = (T)1.;
+
+          for (int k = 0; k < max_k; k++) {
+
+            term *= z / ((b + (T)k) * (T)(k + 1));
+            sum  += term;
+
+            if ( fabs(term) < fabs(sum) * tol ) {
+              return sum;
+            }
 
-          for (int k = 0; k <= max_k; k++) {
-            sum += pow(z, (T)k) / (pochhammer(b, (T)k) * factorial(k))
           }
 
           return sum;
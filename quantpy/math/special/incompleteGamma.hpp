@@ -71,6 +71,150 @@ namespace quantpy {
       }
 
 
+      // Forward declaration needed as the regularized lower and upper incomplete gamma functions
+      // evaluate whichever of the two representations converges fastest and complement the other
+      template <typename T>
+      T regularizedUpperIncompleteGamma(T s, T x, T tol = (T)1e-12, int maxIter = 300);
+
+
+      /**
+       * @brief Calculates the regularized lower incomplete gamma function \f$ P(s, x) \f$
+       * @details Evaluates \f$ P(s, x) = \gamma(s, x) / \Gamma(s) \f$ with the standard split between
+       * a series expansion (for \f$ x < s + 1 \f$) and a continued fraction for the complement
+       * (otherwise), following Press et. al. [1]. The shared prefactor \f$ x^s e^{-x} / \Gamma(s) \f$
+       * is evaluated in log space, so the function remains accurate for arguments that would overflow
+       * the quadrature based 'lowerIncompleteGamma'
+       * [1]: W. Press, S. Teukolsky, W. Vetterling and B. Flannery. "Numerical Recipes: The Art of
+       * Scientific Computing", Cambridge University Press, 2007
+       * @tparam T       The template type. Should be some floating point type
+       * @param s        The exponential parameter in the integral. Needs to be positive
+       * @param x        The limit of the incomplete integral. Needs to be non-negative
+       * @param tol      The relative tolerance at which the expansion is terminated. Defaults to 1e-12
+       * @param maxIter  The maximum number of terms used in the expansion. Defaults to 300
+       * @returns        The regularized lower incomplete gamma
+       */
+      template <typename T>
+      T regularizedLowerIncompleteGamma(T s, T x, T tol = (T)1e-12, int maxIter = 300) {
+
+        if ( s <= (T)0. ) {
+          ERROR("The exponential parameter needs to be positive! (", s, " <= 0)");
+        }
+
+        if ( x < (T)0. ) {
+          ERROR("The limit of the integral can not be negative! (", x, " < 0)");
+        }
+
+        if ( x == (T)0. ) {
+          return (T)0.;
+        }
+
+        // The continued fraction converges faster for large arguments
+        if ( x >= s + (T)1. ) {
+          return (T)1. - regularizedUpperIncompleteGamma(s, x, tol, maxIter);
+        }
+
+        // The shared prefactor evaluated in log space to avoid overflowing x^s and gamma(s)
+        T prefactor = exp(s * log(x) - x - lgamma(s));
+
+        T denom = s;
+        T term  = (T)1. / s;
+        T sum   = term;
+
+        for (int i = 0; i < maxIter; i++) {
+
+          denom += (T)1.;
+          term  *= x / denom;
+          sum   += term;
+
+          if ( fabs(term) < fabs(sum) * tol ) {
+            return prefactor * sum;
+          }
+
+        }
+
+        WARNING("The series expansion did not converge in ", maxIter, " terms!");
+
+        return prefactor * sum;
+
+      }
+
+
+      /**
+       * @brief Calculates the regularized upper incomplete gamma function \f$ Q(s, x) \f$
+       * @details Evaluates \f$ Q(s, x) = \Gamma(s, x) / \Gamma(s) \f$ with a continued fraction
+       * expansion (for \f$ x \geq s + 1 \f$) evaluated with the modified Lentz's method and the
+       * complement of the series expansion otherwise, following Press et. al. [1]. Unlike the
+       * subtraction \f$ \Gamma(s) - \gamma(s, x) \f$ the continued fraction retains full relative
+       * accuracy in the tail, where the subtraction loses all significant digits
+       * [1]: W. Press, S. Teukolsky, W. Vetterling and B. Flannery. "Numerical Recipes: The Art of
+       * Scientific Computing", Cambridge University Press, 2007
+       * @tparam T       The template type. Should be some floating point type
+       * @param s        The exponential parameter in the integral. Needs to be positive
+       * @param x        The limit of the incomplete integral. Needs to be non-negative
+       * @param tol      The relative tolerance at which the expansion is terminated. Defaults to 1e-12
+       * @param maxIter  The maximum number of terms used in the expansion. Defaults to 300
+       * @returns        The regularized upper incomplete gamma
+       */
+      template <typename T>
+      T regularizedUpperIncompleteGamma(T s, T x, T tol, int maxIter) {
+
+        if ( s <= (T)0. ) {
+          ERROR("The exponential parameter needs to be positive! (", s, " <= 0)");
+        }
+
+        if ( x < (T)0. ) {
+          ERROR("The limit of the integral can not be negative! (", x, " < 0)");
+        }
+
+        if ( x == (T)0. ) {
+          return (T)1.;
+        }
+
+        // The series expansion converges faster for small arguments
+        if ( x < s + (T)1. ) {
+          return (T)1. - regularizedLowerIncompleteGamma(s, x, tol, maxIter);
+        }
+
+        // A tiny floor keeping the Lentz recurrences away from division by zero
+        const T floor = (T)1e-30;
+
+        // The shared prefactor evaluated in log space to avoid overflowing x^s and gamma(s)
+        T prefactor = exp(s * log(x) - x - lgamma(s));
+
+        T b = x + (T)1. - s;
+        T c = (T)1. / floor;
+        T d = (T)1. / b;
+        T h = d;
+
+        for (int i = 1; i <= maxIter; i++) {
+
+          T a = -(T)i * ((T)i - s);
+          b  += (T)2.;
+
+          d = a * d + b;
+          if ( fabs(d) < floor ) { d = floor; }
+
+          c = b + a / c;
+          if ( fabs(c) < floor ) { c = floor; }
+
+          d = (T)1. / d;
+
+          T delta = d * c;
+          h *= delta;
+
+          if ( fabs(delta - (T)1.) < tol ) {
+            return prefactor * h;
+          }
+
+        }
+
+        WARNING("The continued fraction expansion did not converge in ", maxIter, " terms!");
+
+        return prefactor * h;
+
+      }
+
+
     }
 
   }
@@ -0,0 +1,110 @@
+/**
+ * @file factorial_tests.cpp
+ * @brief Definition of tests for the factorial functions
+ * @details Compile in the main quantpy directory with:
+ * > g++ -std=c++17 -mavx -fopenmp -Wall quantpy/math/special/tests/factorial_tests.cpp -lm -o factorial_tests.o
+ * Run with:
+ * > ./factorial_tests.o
+ * @author Kasper Rantamäki
+ * @date 2026-08-29
+ */
+
+
+#include <cmath>
+
+#include "../factorial.hpp"
+#include "../../../cpp/testing.hpp"
+#include "../../../cpp/logging.hpp"
+
+
+#ifndef TEST_TOL
+  #define TEST_TOL 1e-12
+#endif
+
+
+namespace quantpy {
+
+  namespace math {
+
+    namespace special {
+
+      namespace factorial_tests {
+
+
+        // Test 1
+        bool test_factorial1() {
+
+          // The table lookups should reproduce the recursively built factorials exactly
+          bool passed = ( factorial(0.) == 1. );
+
+          double fact = 1.;
+
+          for (int n = 1; n <= 20; n++) {
+            fact *= (double)n;
+            passed = passed && ( factorial((double)n) == fact );
+          }
+
+          return passed;
+
+        }
+
+
+        // Test 2
+        bool test_doubleFactorial1() {
+
+          // The table lookups should reproduce the recursively built double factorials exactly
+          bool passed = ( doubleFactorial(0.) == 1. ) && ( doubleFactorial(1.) == 1. );
+
+          for (int n = 2; n <= 20; n++) {
+            passed = passed && ( doubleFactorial((double)n) == (double)n * doubleFactorial((double)(n - 2)) );
+          }
+
+          return passed;
+
+        }
+
+
+        // Test 3
+        bool test_pochhammer1() {
+
+          // The rising factorial product should match the gamma function ratio
+          bool passed = ( pochhammer(2.5, 0.) == 1. );
+
+          for (int n = 1; n <= 10; n++) {
+
+            double correctValue = tgamma(2.5 + (double)n) / tgamma(2.5);
+            double foundValue   = pochhammer(2.5, (double)n);
+
+            DEBUG("Found value: ", foundValue, " (correct: ", correctValue, ")");
+
+            passed = passed && ( fabs(foundValue - correctValue) < TEST_TOL * correctValue );
+
+          }
+
+          return passed;
+
+        }
+
+
+      }
+
+    }
+
+  }
+
+}
+
+
+int main() {
+
+  quantpy::cpp::logging::verbosity(3);
+
+  quantpy::cpp::testing::TestSuite factorialTests = quantpy::cpp::testing::TestSuite("factorial.hpp");
+
+  factorialTests.addTest(quantpy::math::special::factorial_tests::test_factorial1);
+  factorialTests.addTest(quantpy::math::special::factorial_tests::test_doubleFactorial1);
+  factorialTests.addTest(quantpy::math::special::factorial_tests::test_pochhammer1);
+
+  return (int)factorialTests.runTests();
+
+}
@@ -0,0 +1,108 @@
+/**
+ * @file hypergeometric_tests.cpp
+ * @brief Definition of tests for the hypergeometric functions
+ * @details Compile in the main quantpy directory with:
+ * > g++ -std=c++17 -mavx -fopenmp -Wall quantpy/math/special/tests/hypergeometric_tests.cpp -lm -o hypergeometric_tests.o
+ * Run with:
+ * > ./hypergeometric_tests.o
+ * @author Kasper Rantamäki
+ * @date 2026-08-29
+ */
+
+
+#include <cmath>
+
+#include "../hypergeometric.hpp"
+#include "../../../cpp/testing.hpp"
+#include "../../../cpp/logging.hpp"
+
+
+#ifndef TEST_TOL
+  #define TEST_TOL 1e-12
+#endif
+
+
+namespace quantpy {
+
+  namespace math {
+
+    namespace special {
+
+      namespace hypergeometric_tests {
+
+
+        // Test 1
+        bool test_hyp0F1_1() {
+
+          // The identity 0F1(; 1/2, x) = cosh(2 sqrt(x)) holds for positive arguments
+          bool passed = true;
+
+          for (double x : { 0.1, 0.5, 1., 2., 5. }) {
+
+            double correctValue = cosh(2. * sqrt(x));
+            double foundValue   = hypergeometric::hyp0F1<double>(x, 0.5);
+
+            DEBUG("Found value: ", foundValue, " (correct: ", correctValue, ")");
+
+            passed = passed && ( fabs(foundValue - correctValue) < TEST_TOL * correctValue );
+
+          }
+
+          return passed;
+
+        }
+
+
+        // Test 2
+        bool test_hyp0F1_2() {
+
+          // The identity 0F1(; 3/2, x) = sinh(2 sqrt(x)) / (2 sqrt(x)) holds for positive arguments
+          bool passed = true;
+
+          for (double x : { 0.1, 0.5, 1., 2., 5. }) {
+
+            double correctValue = sinh(2. * sqrt(x)) / (2. * sqrt(x));
+            double foundValue   = hypergeometric::hyp0F1<double>(x, 1.5);
+
+            DEBUG("Found value: ", foundValue, " (correct: ", correctValue, ")");
+
+            passed = passed && ( fabs(foundValue - correctValue) < TEST_TOL * correctValue );
+
+          }
+
+          return passed;
+
+        }
+
+
+        // Test 3
+        bool test_hyp0F1_3() {
+
+          // At zero the sum reduces to its leading term
+          return hypergeometric::hyp0F1<double>(0., 2.) == 1.;
+
+        }
+
+
+      }
+
+    }
+
+  }
+
+}
+
+
+int main() {
+
+  quantpy::cpp::logging::verbosity(3);
+
+  quantpy::cpp::testing::TestSuite hypergeometricTests = quantpy::cpp::testing::TestSuite("hypergeometric.hpp");
+
+  hypergeometricTests.addTest(quantpy::math::special::hypergeometric_tests::test_hyp0F1_1);
+  hypergeometricTests.addTest(quantpy::math::special::hypergeometric_tests::test_hyp0F1_2);
+  hypergeometricTests.addTest(quantpy::math::special::hypergeometric_tests::test_hyp0F1_3);
+
+  return (int)hypergeometricTests.runTests();
+
+}
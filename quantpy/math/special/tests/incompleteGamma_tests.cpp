@@ -81,6 +81,60 @@ namespace quantpy {
         }
 
 
+        // Test 5
+        bool test_regularizedLowerIncompleteGamma1() {
+
+          double correctValue = 0.8008517265;
+          double foundValue   = regularizedLowerIncompleteGamma<double>(2., 3.);
+
+          DEBUG("Found value: ", foundValue);
+
+          return ( fabs(correctValue - foundValue) < TEST_TOL );
+
+        }
+
+
+        // Test 6
+        bool test_regularizedUpperIncompleteGamma1() {
+
+          double correctValue = 0.9988975318;
+          double foundValue   = regularizedUpperIncompleteGamma<double>(10., 3.);
+
+          DEBUG("Found value: ", foundValue);
+
+          return ( fabs(correctValue - foundValue) < TEST_TOL );
+
+        }
+
+
+        // Test 7
+        bool test_regularizedUpperIncompleteGamma2() {
+
+          // Q(0.5, x) equals erfc(sqrt(x)), which the quadrature based functions can not evaluate as they require s >= 1
+          double correctValue = erfc(1.);
+          double foundValue   = regularizedUpperIncompleteGamma<double>(0.5, 1.);
+
+          DEBUG("Found value: ", foundValue);
+
+          return ( fabs(correctValue - foundValue) < TEST_TOL );
+
+        }
+
+
+        // Test 8
+        bool test_regularizedLowerIncompleteGamma2() {
+
+          // Arguments this large overflow the integrand of the quadrature based functions
+          double correctValue = 1.;
+          double foundValue   = regularizedLowerIncompleteGamma<double>(4., 700.);
+
+          DEBUG("Found value: ", foundValue);
+
+          return ( fabs(correctValue - foundValue) < TEST_TOL );
+
+        }
+
+
       }
 
     }
@@ -100,6 +154,10 @@ int main() {
   incompleteGammaTests.addTest(quantpy::math::special::incompleteGamma_tests::test_upperIncompleteGamma1);
   incompleteGammaTests.addTest(quantpy::math::special::incompleteGamma_tests::test_lowerIncompleteGamma2);
   incompleteGammaTests.addTest(quantpy::math::special::incompleteGamma_tests::test_upperIncompleteGamma2);
+  incompleteGammaTests.addTest(quantpy::math::special::incompleteGamma_tests::test_regularizedLowerIncompleteGamma1);
+  incompleteGammaTests.addTest(quantpy::math::special::incompleteGamma_tests::test_regularizedUpperIncompleteGamma1);
+  incompleteGammaTests.addTest(quantpy::math::special::incompleteGamma_tests::test_regularizedUpperIncompleteGamma2);
+  incompleteGammaTests.addTest(quantpy::math::special::incompleteGamma_tests::test_regularizedLowerIncompleteGamma2);
 
 
   return (int)incompleteGammaTests.runTests();
@@ -10,6 +10,7 @@
 
 
 #include <functional>
+#include <vector>
 
 
 namespace quantpy {
@@ -19,6 +20,29 @@ namespace quantpy {
     namespace stochasticProcesses {
 
 
+      /**
+       * @brief Term-structure policy for a flat curve
+       * @details Callable like the std::function based term-structures, but as the call is constexpr
+       * and the struct holds just the constant, a process templated on it can inline the term-structure
+       * evaluations into its sampling loop instead of dispatching through type erasure
+       * @tparam T  The template type. Should be some floating point number type
+       */
+      template <typename T>
+      struct FlatTermStructure {
+
+        T value;  /**< The constant value returned for every maturity */
+
+
+        /**
+         * @brief Evaluates the term-structure at a given maturity
+         * @param tau  The time to maturity in years. Not considered as the curve is flat
+         * @returns    The constant value of the curve
+         */
+        constexpr T operator() (T tau) const { return value; }
+
+      };
+
+
       /**
        * @brief Virtual base class for stochastic processes
        * @tparam T  The template type. Should be some floating point number type
@@ -64,6 +88,29 @@ namespace quantpy {
            */
           virtual std::vector<T> sample(T v0, T tau, int n) const = 0;
 
+
+          /**
+           * @brief Virtual function for sampling a path into caller-owned buffers
+           * @details The default implementation falls back on the allocating 'sample' method. Derived
+           * classes should override this with an allocation-free implementation so that e.g. a Monte Carlo
+           * pricer can reuse one pair of buffers per thread across all of its trials
+           * @param v0       The initial value for the process
+           * @param tau      The time to maturity from the the initial point
+           * @param n        The number of steps taken
+           * @param path     Pointer to a buffer of at least n + 1 values into which the path is written
+           * @param scratch  Pointer to a scratch buffer of at least n values usable for e.g. the random draws
+           * @returns        Void. The path is written into the 'path' buffer
+           */
+          virtual void sampleInto(T v0, T tau, int n, T* path, T* scratch) const {
+
+            std::vector<T> sampledPath = this->sample(v0, tau, n);
+
+            for (int i = 0; i <= n; i++) {
+              path[i] = sampledPath[i];
+            }
+
+          }
+
       };
 
 
@@ -0,0 +1,195 @@
+/**
+ * @file BrownianBridge.hpp
+ * @brief Brownian bridge construction of a discrete Brownian path
+ * @details Builds a standard Brownian path on a uniform grid by first fixing the terminal value and
+ * then recursively filling in the conditional midpoints, instead of summing the increments left to
+ * right. The construction is described in Chapter 3.1 of Glasserman's book [1]. Statistically both
+ * orderings are equivalent, but the bridge loads most of the path variance onto the first few
+ * draws, which is exactly what low-discrepancy sequences need: their leading dimensions are the
+ * well-distributed ones, so pairing them with the high-variance bridge levels preserves the
+ * quasi-Monte Carlo convergence rate in high-dimensional path sampling.
+ * [1]: P. Glasserman. "Monte Carlo Methods in Financial Engineering", Springer, 2004
+ * @author Kasper Rantamäki
+ * @date 2026-08-29
+ */
+
+#ifndef BROWNIAN_BRIDGE_HPP
+#define BROWNIAN_BRIDGE_HPP
+
+
+#include <cmath>
+#include <vector>
+
+#include "../../cpp/logging.hpp"
+
+
+namespace quantpy {
+
+  namespace math {
+
+    namespace stochasticProcesses {
+
+
+      /**
+       * @brief Brownian bridge construction of a discrete Brownian path on a uniform unit-spaced grid
+       * @details The construction order, interpolation weights and conditional standard deviations
+       * depend only on the number of steps, so they are precomputed once in the constructor and the
+       * per-path transform is just a weighted pass over the draws. The grid spacing is taken as one,
+       * making the produced increments standard normal; callers scale them with their own per-step
+       * diffusion terms, e.g. through a sampling plan
+       * @tparam T  The template type. Should be some floating point number type
+       */
+      template <typename T>
+      class BrownianBridge {
+
+        protected:
+
+          int _n;                        /**< The number of steps in the constructed path */
+          std::vector<int> _bridgeIndex; /**< The index of the point constructed at each level */
+          std::vector<int> _leftIndex;   /**< The index of the left conditioning point at each level */
+          std::vector<int> _rightIndex;  /**< The index of the right conditioning point at each level */
+          std::vector<T> _leftWeight;    /**< The interpolation weight of the left conditioning point */
+          std::vector<T> _rightWeight;   /**< The interpolation weight of the right conditioning point */
+          std::vector<T> _stdDev;        /**< The conditional standard deviation at each level */
+
+        public:
+
+          /**
+           * @brief Default constructor
+           * @returns  Uninitialized BrownianBridge object
+           */
+          BrownianBridge() : _n(0) {  }
+
+
+          /**
+           * @brief Main constructor. Precomputes the construction order and weights
+           * @param n  The number of steps in the constructed path
+           * @returns  Initialized BrownianBridge object
+           */
+          BrownianBridge(int n) : _n(n) {
+
+            if ( n < 1 ) {
+              ERROR("The number of steps must be positive! (", n, " < 1)");
+            }
+
+            this->_bridgeIndex.resize(n);
+            this->_leftIndex.resize(n);
+            this->_rightIndex.resize(n);
+            this->_leftWeight.resize(n);
+            this->_rightWeight.resize(n);
+            this->_stdDev.resize(n);
+
+            // Marks for each point the level at which it gets constructed
+            std::vector<int> constructionLevel(n, 0);
+
+            // The terminal point is constructed first from the full path variance
+            constructionLevel[n - 1] = 1;
+
+            this->_bridgeIndex[0] = n - 1;
+            this->_leftIndex[0]   = 0;
+            this->_rightIndex[0]  = n - 1;
+            this->_leftWeight[0]  = (T)0.;
+            this->_rightWeight[0] = (T)0.;
+            this->_stdDev[0]      = sqrt((T)n);
+
+            // The remaining points are filled in as conditional midpoints of the yet unfilled
+            // segments, splitting the longest segments first
+            int j = 0;
+
+            for (int level = 1; level < n; level++) {
+
+              // Find the start of the next unfilled segment and the filled point bounding it
+              while ( constructionLevel[j] != 0 ) {
+                j++;
+              }
+
+              int k = j;
+
+              while ( constructionLevel[k] == 0 ) {
+                k++;
+              }
+
+              int l = j + ((k - 1 - j) >> 1);
+
+              constructionLevel[l] = level + 1;
+
+              this->_bridgeIndex[level] = l;
+              this->_leftIndex[level]   = j;
+              this->_rightIndex[level]  = k;
+
+              if ( j != 0 ) {
+                this->_leftWeight[level]  = (T)(k - l) / (T)(k + 1 - j);
+                this->_rightWeight[level] = (T)(l + 1 - j) / (T)(k + 1 - j);
+                this->_stdDev[level]      = sqrt((T)((l + 1 - j) * (k - l)) / (T)(k + 1 - j));
+              }
+              else {
+                this->_leftWeight[level]  = (T)(k - l) / (T)(k + 1);
+                this->_rightWeight[level] = (T)(l + 1) / (T)(k + 1);
+                this->_stdDev[level]      = sqrt((T)((l + 1) * (k - l)) / (T)(k + 1));
+              }
+
+              j = k + 1;
+
+              if ( j >= n ) {
+                j = 0;
+              }
+
+            }
+
+          }
+
+
+          /**
+           * @brief Getter for the number of steps in the constructed path
+           * @returns The number of steps
+           */
+          const int& n() const { return this->_n; }
+
+
+          /**
+           * @brief Transforms standard normal draws into standardized Brownian increments
+           * @details The draws are consumed in construction order, so the first draws decide the
+           * coarse shape of the path and the later ones only refine it. The path is materialized
+           * into the output buffer and differenced in place, leaving one standard normal increment
+           * per step
+           * @param draws  Pointer to a buffer of 'n' independent standard normal draws
+           * @param out    Pointer to a buffer of at least 'n' values into which the increments are written
+           * @returns      Void. The increments are written into the 'out' buffer
+           */
+          void transform(const T* draws, T* out) const {
+
+            out[this->_bridgeIndex[0]] = this->_stdDev[0] * draws[0];
+
+            for (int level = 1; level < this->_n; level++) {
+
+              int j = this->_leftIndex[level];
+              int k = this->_rightIndex[level];
+              int l = this->_bridgeIndex[level];
+
+              if ( j != 0 ) {
+                out[l] = this->_leftWeight[level] * out[j - 1] + this->_rightWeight[level] * out[k] + this->_stdDev[level] * draws[level];
+              }
+              else {
+                out[l] = this->_rightWeight[level] * out[k] + this->_stdDev[level] * draws[level];
+              }
+
+            }
+
+            // Difference the path in place into the per-step increments
+            for (int i = this->_n - 1; i >= 1; i--) {
+              out[i] -= out[i - 1];
+            }
+
+          }
+
+      };
+
+
+    }
+
+  }
+
+}
+
+
+#endif
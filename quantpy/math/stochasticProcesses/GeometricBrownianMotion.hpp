@@ -25,14 +25,44 @@ namespace quantpy {
     namespace stochasticProcesses {
 
 
+      /**
+       * @brief Precomputed per-step coefficients for sampling a geometric Brownian motion
+       * @details The per-step drift and diffusion terms depend only on the time to maturity and the
+       * number of steps, not on the trial, so over e.g. a million Monte Carlo trials the term-structure
+       * and transcendental evaluations behind them are identical every time. A plan is built once per
+       * (tau, n) pricing call and the per-trial sampling loop just reads the tables
+       * @tparam T  The template type. Should be some floating point number type
+       */
+      template <typename T>
+      struct SamplingPlan {
+
+        std::vector<T> drift;      /**< The per-step drift terms \f$ (r_i - q_i - \sigma_i^2 / 2) \Delta t \f$ */
+        std::vector<T> diffusion;  /**< The per-step diffusion scales \f$ \sigma_i \sqrt{\Delta t} \f$ */
+
+      };
+
+
       /**
        * @brief Implementation of a general geometric Brownian motion
        * @details Based on the Chapter 21 in Hull's book [1].
+       * The term-structures are held as a template policy so that the dominant flat-curve case can
+       * bypass the type-erased std::function dispatch: with 'FlatTermStructure' the evaluations
+       * inline into the sampling loop, collapsing each step to a handful of fused multiply-adds.
+       * The std::function based policy remains the default, so 'GeometricBrownianMotion<T>'
+       * behaves as before
        * [1]: J. Hull. "Options, Futures and Other Derivatives", Pearson Education Limited, 2018
+       * @tparam T              The template type. Should be some floating point number type
+       * @tparam TermStructure  The term-structure policy. Should be callable as T(T)
        */
-      template <typename T>
+      template <typename T, typename TermStructure = std::function<T (T)>>
       class GeometricBrownianMotion : public BaseStochasticProcess<T> {
 
+        protected:
+
+          TermStructure _rts;    /**< The term-structure for the risk-free rate */
+          TermStructure _qts;    /**< The term-structure for the dividend yield */
+          TermStructure _volts;  /**< The term-structure for the volatility */
+
         public:
 
           /**
@@ -44,13 +74,13 @@ namespace quantpy {
 
           /**
            * @brief Main constructor
-           * @details If a constant term-structure is desired, a simple lambda function that returns a constant
-           * value can be passed to the constructor
+           * @details If a constant term-structure is desired, the 'FlatTermStructure' policy should be
+           * preferred over a constant-returning lambda behind the default std::function policy
            * @param rts    The term-structure for the risk-free rate
            * @param qts    The term-structure for the dividend yield
            * @param volts  The term-structure for the volatility
            */
-          GeometricBrownianMotion(std::function<T (T)> rts, std::function<T (T)> qts, std::function<T (T)> volts) {
+          GeometricBrownianMotion(TermStructure rts, TermStructure qts, TermStructure volts) {
 
             this->_rts   = rts;
             this->_qts   = qts;
@@ -59,6 +89,27 @@ namespace quantpy {
           }
 
 
+          /**
+           * @brief Evaluates the term-structure of risk-free rates through the policy
+           * @returns The risk-free rate for a given maturity
+           */
+          T rts(T tau) const override { return this->_rts(tau); }
+
+
+          /**
+           * @brief Evaluates the term-structure of volatilities through the policy
+           * @returns The volatility for a given maturity
+           */
+          T volts(T tau) const override { return this->_volts(tau); }
+
+
+          /**
+           * @brief Evaluates the term-structure of dividend yields through the policy
+           * @returns The dividend yield for a given maturity
+           */
+          T qts(T tau) const override { return this->_qts(tau); }
+
+
           /**
            * @brief Samples a path starting at value 'v0' and going forward 'tau' amount of time in 'n' steps
            * @param v0   The initial value for the process
@@ -72,12 +123,38 @@ namespace quantpy {
               ERROR("The number of samples must be positive! (", n, " < 1)");
             }
 
-            std::vector<T> normalSamples = quantpy::math::probability::normal::sample((T)0., (T)1., n);
-            std::vector<T> path;
-            path.reserve(n + 1);
+            std::vector<T> path(n + 1);
+            std::vector<T> scratch(n);
+
+            this->sampleInto(v0, tau, n, path.data(), scratch.data());
+
+            return path;
+
+          }
+
+
+          /**
+           * @brief Samples a path into caller-owned buffers without allocating
+           * @details The normal draws are generated with a per-thread sampler so repeated calls neither
+           * allocate nor reconstruct the generator, taking the allocator entirely off the Monte Carlo hot path
+           * @param v0       The initial value for the process
+           * @param tau      The time to maturity from the the initial point
+           * @param n        The number of steps taken
+           * @param path     Pointer to a buffer of at least n + 1 values into which the path is written
+           * @param scratch  Pointer to a scratch buffer of at least n values used for the normal draws
+           * @returns        Void. The path is written into the 'path' buffer
+           */
+          void sampleInto(T v0, T tau, int n, T* path, T* scratch) const override {
+
+            if ( n < 1 ) {
+              ERROR("The number of samples must be positive! (", n, " < 1)");
+            }
+
+            static thread_local quantpy::math::probability::normal::NormalSampler<T> sampler{};
+            sampler.fill(scratch, n);
+
+            path[0] = v0;
 
-            path.push_back(v0);
-            
             T dt = tau / (T)n;
             T St = v0;
             T sqrtdt = sqrt(dt);
@@ -86,14 +163,162 @@ namespace quantpy {
               T tau_i = tau - i * dt;
               T vol_i = this->_volts(tau_i);
               // Note that the mean is assumed to be the risk-free rate minus the dividend yield
-              St = St * exp((this->_rts(tau_i) - this->_qts(tau_i) - vol_i * vol_i / (T)2.) * dt + vol_i * normalSamples[i - 1] * sqrtdt);
-              path.push_back(St);
+              St = St * exp((this->_rts(tau_i) - this->_qts(tau_i) - vol_i * vol_i / (T)2.) * dt + vol_i * scratch[i - 1] * sqrtdt);
+              path[i] = St;
             }
 
-            return path;
+          }
+
+
+          /**
+           * @brief Builds a sampling plan for a given time to maturity and number of steps
+           * @details Evaluates the term-structures once per step, so the per-trial sampling done
+           * against the plan involves no term-structure or transcendental evaluations at all
+           * @param tau  The time to maturity from the the initial point
+           * @param n    The number of steps taken
+           * @returns    The sampling plan holding the per-step drift and diffusion tables
+           */
+          SamplingPlan<T> plan(T tau, int n) const {
+
+            if ( n < 1 ) {
+              ERROR("The number of samples must be positive! (", n, " < 1)");
+            }
+
+            SamplingPlan<T> plan;
+            plan.drift.resize(n);
+            plan.diffusion.resize(n);
+
+            T dt = tau / (T)n;
+            T sqrtdt = sqrt(dt);
+
+            for (int i = 1; i <= n; i++) {
+              T tau_i = tau - i * dt;
+              T vol_i = this->_volts(tau_i);
+              // Note that the mean is assumed to be the risk-free rate minus the dividend yield
+              plan.drift[i - 1]     = (this->_rts(tau_i) - this->_qts(tau_i) - vol_i * vol_i / (T)2.) * dt;
+              plan.diffusion[i - 1] = vol_i * sqrtdt;
+            }
+
+            return plan;
+
+          }
+
+
+          /**
+           * @brief Samples a path into caller-owned buffers against a precomputed plan
+           * @details The steps are accumulated in log space from the plan tables, so each step is a
+           * fused multiply-add plus the exponential needed to materialize the path value
+           * @param v0       The initial value for the process
+           * @param plan     The sampling plan built with 'plan' for the desired (tau, n) pair
+           * @param path     Pointer to a buffer of at least n + 1 values into which the path is written
+           * @param scratch  Pointer to a scratch buffer of at least n values used for the normal draws
+           * @returns        Void. The path is written into the 'path' buffer
+           */
+          void sampleInto(T v0, const SamplingPlan<T>& plan, T* path, T* scratch) const {
+
+            int n = (int)plan.drift.size();
+
+            static thread_local quantpy::math::probability::normal::NormalSampler<T> sampler{};
+            sampler.fill(scratch, n);
+
+            path[0] = v0;
+
+            T logSt = log(v0);
+
+            for (int i = 1; i <= n; i++) {
+              logSt += plan.drift[i - 1] + plan.diffusion[i - 1] * scratch[i - 1];
+              path[i] = exp(logSt);
+            }
+
+          }
+
+
+          /**
+           * @brief Samples a terminal value of the process against a precomputed plan
+           * @details As only the terminal value is materialized, the log-space accumulation costs a
+           * single fused multiply-add per step and one exponential at the end. This is the preferred
+           * entry point for path-independent Monte Carlo with a curved term-structure
+           * @param v0       The initial value for the process
+           * @param plan     The sampling plan built with 'plan' for the desired (tau, n) pair
+           * @param scratch  Pointer to a scratch buffer of at least n values used for the normal draws
+           * @returns        The terminal value of the sampled path
+           */
+          T sampleTerminal(T v0, const SamplingPlan<T>& plan, T* scratch) const {
+
+            int n = (int)plan.drift.size();
+
+            static thread_local quantpy::math::probability::normal::NormalSampler<T> sampler{};
+            sampler.fill(scratch, n);
+
+            T logSt = log(v0);
+
+            for (int i = 0; i < n; i++) {
+              logSt += plan.drift[i] + plan.diffusion[i] * scratch[i];
+            }
+
+            return exp(logSt);
 
           }
-        
+
+
+          /**
+           * @brief Computes the terminal value implied by given standardized draws against a precomputed plan
+           * @details Unlike the sampling methods this involves no randomness: the caller supplies the
+           * standardized per-step increments, e.g. quasi-random draws run through a Brownian bridge,
+           * and the method just folds them through the plan tables in log space
+           * @param v0     The initial value for the process
+           * @param plan   The sampling plan built with 'plan' for the desired (tau, n) pair
+           * @param draws  Pointer to a buffer of n standardized per-step increments
+           * @returns      The terminal value implied by the draws
+           */
+          T terminalValue(T v0, const SamplingPlan<T>& plan, const T* draws) const {
+
+            int n = (int)plan.drift.size();
+
+            T logSt = log(v0);
+
+            for (int i = 0; i < n; i++) {
+              logSt += plan.drift[i] + plan.diffusion[i] * draws[i];
+            }
+
+            return exp(logSt);
+
+          }
+
+
+          /**
+           * @brief Samples terminal values of the process directly from the lognormal terminal law
+           * @details For path-independent applications there is no need to materialize a path at all:
+           * the terminal value follows a lognormal distribution whose drift and diffusion terms are
+           * computed once per block. The draws are written into the output buffer and transformed in
+           * place, so a block of terminal values costs one exponential per value and no allocations.
+           * Equivalent to single-step path sampling with the term structures evaluated at maturity zero
+           * @param v0   The initial value for the process
+           * @param tau  The time to maturity from the the initial point
+           * @param n    The number of terminal values drawn
+           * @param out  Pointer to a buffer of at least n values into which the terminal values are written
+           * @returns    Void. The terminal values are written into the 'out' buffer
+           */
+          void sampleTerminal(T v0, T tau, int n, T* out) const {
+
+            if ( n < 1 ) {
+              ERROR("The number of samples must be positive! (", n, " < 1)");
+            }
+
+            static thread_local quantpy::math::probability::normal::NormalSampler<T> sampler{};
+            sampler.fill(out, n);
+
+            T vol = this->_volts((T)0.);
+            // Note that the mean is assumed to be the risk-free rate minus the dividend yield
+            T drift = (this->_rts((T)0.) - this->_qts((T)0.) - vol * vol / (T)2.) * tau;
+            T diffusion = vol * sqrt(tau);
+
+            for (int i = 0; i < n; i++) {
+              out[i] = v0 * exp(drift + diffusion * out[i]);
+            }
+
+          }
+
       };
 
 
@@ -0,0 +1,248 @@
+/**
+ * @file MultiAssetGeometricBrownianMotion_tests.cpp
+ * @brief Definition of tests for the correlated multi-asset geometric Brownian motion engine
+ * @details Compile in the main quantpy directory with:
+ * > g++ -std=c++17 -mavx -fopenmp -Wall quantpy/math/stochasticProcesses/tests/MultiAssetGeometricBrownianMotion_tests.cpp -lm -o MultiAssetGeometricBrownianMotion_tests.o
+ * Run with:
+ * > ./MultiAssetGeometricBrownianMotion_tests.o
+ * @author Kasper Rantamäki
+ * @date 2026-08-29
+ */
+
+
+#include <cmath>
+#include <vector>
+
+#include "../MultiAssetGeometricBrownianMotion.hpp"
+#include "../../../cpp/testing.hpp"
+#include "../../../cpp/logging.hpp"
+
+
+#ifndef TEST_TOL
+  #define TEST_TOL 1e-12
+#endif
+
+
+namespace quantpy {
+
+  namespace math {
+
+    namespace stochasticProcesses_tests {
+
+
+      // Test 1
+      bool test_cholesky1() {
+
+        // The factor of a two asset correlation matrix is known in closed form
+        std::vector<double> r = {0.04, 0.04};
+        std::vector<double> q = {0., 0.};
+        std::vector<double> vol = {0.2, 0.25};
+        std::vector<double> corr = {1., 0.6,
+                                    0.6, 1.};
+
+        stochasticProcesses::MultiAssetGeometricBrownianMotion<double> engine(r, q, vol, corr);
+
+        const std::vector<double>& chol = engine.cholesky();
+
+        DEBUG("Found factor: ", chol[0], ", ", chol[1], ", ", chol[2], " and ", chol[3]);
+
+        return ( fabs(chol[0] - 1.) < TEST_TOL ) && ( fabs(chol[1]) < TEST_TOL ) &&
+               ( fabs(chol[2] - 0.6) < TEST_TOL ) && ( fabs(chol[3] - 0.8) < TEST_TOL );
+
+      }
+
+
+      // Test 2
+      bool test_cholesky2() {
+
+        // The factor times its transpose should recover the correlation matrix
+        std::vector<double> r = {0.04, 0.04, 0.04};
+        std::vector<double> q = {0., 0., 0.};
+        std::vector<double> vol = {0.2, 0.25, 0.3};
+        std::vector<double> corr = {1., 0.5, 0.2,
+                                    0.5, 1., -0.3,
+                                    0.2, -0.3, 1.};
+
+        stochasticProcesses::MultiAssetGeometricBrownianMotion<double> engine(r, q, vol, corr);
+
+        const std::vector<double>& chol = engine.cholesky();
+
+        bool passed = true;
+
+        for (int i = 0; i < 3; i++) {
+          for (int j = 0; j < 3; j++) {
+
+            double sum = 0.;
+
+            for (int k = 0; k < 3; k++) {
+              sum += chol[i * 3 + k] * chol[j * 3 + k];
+            }
+
+            passed = passed && ( fabs(sum - corr[i * 3 + j]) < TEST_TOL );
+
+          }
+        }
+
+        return passed;
+
+      }
+
+
+      // Test 3
+      bool test_correlate1() {
+
+        // The in-place transform should match the lower-triangular matrix-vector product
+        std::vector<double> r = {0.04, 0.04, 0.04};
+        std::vector<double> q = {0., 0., 0.};
+        std::vector<double> vol = {0.2, 0.25, 0.3};
+        std::vector<double> corr = {1., 0.5, 0.2,
+                                    0.5, 1., -0.3,
+                                    0.2, -0.3, 1.};
+
+        stochasticProcesses::MultiAssetGeometricBrownianMotion<double> engine(r, q, vol, corr);
+
+        const std::vector<double>& chol = engine.cholesky();
+
+        std::vector<double> tile = {0.3, -1.2, 0.7};
+        std::vector<double> correct(3, 0.);
+
+        for (int i = 0; i < 3; i++) {
+          for (int j = 0; j <= i; j++) {
+            correct[i] += chol[i * 3 + j] * tile[j];
+          }
+        }
+
+        engine.correlate(tile.data());
+
+        return ( fabs(tile[0] - correct[0]) < TEST_TOL ) && ( fabs(tile[1] - correct[1]) < TEST_TOL ) &&
+               ( fabs(tile[2] - correct[2]) < TEST_TOL );
+
+      }
+
+
+      // Test 4
+      bool test_fillCorrelated1() {
+
+        // The sample correlation of a large block of draws should land near the target
+        std::vector<double> r = {0.04, 0.04};
+        std::vector<double> q = {0., 0.};
+        std::vector<double> vol = {0.2, 0.25};
+        std::vector<double> corr = {1., 0.6,
+                                    0.6, 1.};
+
+        stochasticProcesses::MultiAssetGeometricBrownianMotion<double> engine(r, q, vol, corr);
+
+        int nSteps = 200000;
+        std::vector<double> draws(nSteps * 2);
+
+        engine.fillCorrelated(draws.data(), nSteps);
+
+        double sum0 = 0., sum1 = 0., sum00 = 0., sum11 = 0., sum01 = 0.;
+
+        for (int s = 0; s < nSteps; s++) {
+          double z0 = draws[s * 2];
+          double z1 = draws[s * 2 + 1];
+          sum0 += z0;
+          sum1 += z1;
+          sum00 += z0 * z0;
+          sum11 += z1 * z1;
+          sum01 += z0 * z1;
+        }
+
+        double mean0 = sum0 / nSteps;
+        double mean1 = sum1 / nSteps;
+        double var0 = sum00 / nSteps - mean0 * mean0;
+        double var1 = sum11 / nSteps - mean1 * mean1;
+        double foundCorr = (sum01 / nSteps - mean0 * mean1) / sqrt(var0 * var1);
+
+        DEBUG("Found correlation: ", foundCorr, " (correct 0.6)");
+
+        // The tolerance accounts for the Monte Carlo error of the correlation estimate
+        return fabs(foundCorr - 0.6) < 0.02;
+
+      }
+
+
+      // Test 5
+      bool test_sample1() {
+
+        // With zero volatilities the paths collapse onto the deterministic forward curves
+        std::vector<double> r = {0.04, 0.06};
+        std::vector<double> q = {0.01, 0.};
+        std::vector<double> vol = {0., 0.};
+        std::vector<double> corr = {1., 0.,
+                                    0., 1.};
+
+        stochasticProcesses::MultiAssetGeometricBrownianMotion<double> engine(r, q, vol, corr);
+
+        std::vector<double> v0 = {100., 50.};
+        int n = 10;
+        double tau = 2.;
+
+        std::vector<double> path = engine.sample(v0, tau, n);
+
+        bool passed = ( (int)path.size() == (n + 1) * 2 );
+
+        for (int s = 0; s <= n; s++) {
+          double t = tau * s / n;
+          passed = passed && ( fabs(path[s * 2] - 100. * exp((0.04 - 0.01) * t)) < 1e-10 );
+          passed = passed && ( fabs(path[s * 2 + 1] - 50. * exp(0.06 * t)) < 1e-10 );
+        }
+
+        return passed;
+
+      }
+
+
+      // Test 6
+      bool test_sampleTerminal1() {
+
+        // The terminal tile should match the last tile of a full path in the zero volatility case
+        std::vector<double> r = {0.04, 0.06};
+        std::vector<double> q = {0.01, 0.};
+        std::vector<double> vol = {0., 0.};
+        std::vector<double> corr = {1., 0.,
+                                    0., 1.};
+
+        stochasticProcesses::MultiAssetGeometricBrownianMotion<double> engine(r, q, vol, corr);
+
+        std::vector<double> v0 = {100., 50.};
+        int n = 10;
+        double tau = 2.;
+
+        std::vector<double> out(2);
+        std::vector<double> scratch(n * 2);
+
+        engine.sampleTerminalInto(v0.data(), tau, n, out.data(), scratch.data());
+
+        DEBUG("Found terminal values: ", out[0], " and ", out[1]);
+
+        return ( fabs(out[0] - 100. * exp((0.04 - 0.01) * tau)) < 1e-10 ) &&
+               ( fabs(out[1] - 50. * exp(0.06 * tau)) < 1e-10 );
+
+      }
+
+
+    }
+
+  }
+
+}
+
+
+int main() {
+
+  quantpy::cpp::logging::verbosity(3);
+
+  quantpy::cpp::testing::TestSuite engineTests = quantpy::cpp::testing::TestSuite("MultiAssetGeometricBrownianMotion.hpp");
+
+  engineTests.addTest(quantpy::math::stochasticProcesses_tests::test_cholesky1);
+  engineTests.addTest(quantpy::math::stochasticProcesses_tests::test_cholesky2);
+  engineTests.addTest(quantpy::math::stochasticProcesses_tests::test_correlate1);
+  engineTests.addTest(quantpy::math::stochasticProcesses_tests::test_fillCorrelated1);
+  engineTests.addTest(quantpy::math::stochasticProcesses_tests::test_sample1);
+  engineTests.addTest(quantpy::math::stochasticProcesses_tests::test_sampleTerminal1);
+
+  return (int)engineTests.runTests();
+
+}
@@ -1,10 +1,24 @@
 """
-The setup script that compiles the C++ libraries and adds the quantpy into the Python site-packages 
+The setup script that compiles the C++ libraries and adds the quantpy into the Python site-packages
 directory so that it can be imported as a library.
 """
+from pybind11.setup_helpers import Pybind11Extension, build_ext
 from setuptools import setup
 
 
+# The extension module holding the C++ pricing kernels. The library itself is header-only, so the
+# single translation unit with the bindings is all that needs compiling
+ext_modules = [
+  Pybind11Extension(
+    "quantpy._quantpy",
+    sources            = ["quantpy/bindings.cpp"],
+    cxx_std            = 17,
+    extra_compile_args = ["-mavx", "-fopenmp", "-Wall"],
+    extra_link_args    = ["-fopenmp"]
+  )
+]
+
+
 # Run the setup
 setup(
   name             = "quantpy",
@@ -13,7 +27,7 @@ setup(
   url              = "https://github.com/krantamaki/quantpy",
   author           = "Kasper Rantamäki",
   license          = "All rights are reserved",
-  packages         = ["quantpy", 
+  packages         = ["quantpy",
                       "quantpy.instruments",
                       "quantpy.instruments.ZeroCouponBond",
                       "quantpy.instruments.ZeroCouponBond.pricers",
@@ -21,10 +35,13 @@ setup(
                       "quantpy.math",
                       "quantpy.math.curve"
                       ],
+  ext_modules      = ext_modules,
+  cmdclass         = {"build_ext": build_ext},
+  setup_requires   = ["pybind11"],
   install_requires = ["pandas",
                       "numpy",
                       "matplotlib",
                       "scipy",
                       "quantlib"
                      ]
-)
\ No newline at end of file
+)